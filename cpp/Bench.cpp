@@ -0,0 +1,217 @@
+// Benchmarks the scheduling entry points on synthetic workloads.
+//
+//   bench [--n 1000,10000] [--span 100000] [--burst 10] [--reps 3]
+//         [--dist uniform,poisson,heavy,bursty] [--json-limit 2000] [--seed 1]
+//
+// For every (distribution, size, policy) it times the *_binary entry point
+// (simulation only) and the JSON entry point, reporting the difference as
+// serialization cost. Peak memory is the heap high-water mark of one run,
+// tracked by the allocator hooks below.
+
+#include "Scheduler.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <malloc.h>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// -------------------- Heap accounting --------------------
+// glibc's malloc_usable_size keeps the bookkeeping out of the allocation.
+// GCC flags free() inside a replaced operator delete as a mismatch.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+static size_t heapNow = 0, heapPeak = 0;
+
+void* operator new(size_t size) {
+    void* p = std::malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    heapNow += malloc_usable_size(p);
+    heapPeak = std::max(heapPeak, heapNow);
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    if (!p) return;
+    heapNow -= malloc_usable_size(p);
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+
+// -------------------- Workloads --------------------
+struct Workload {
+    std::vector<int> arrival, burst, priority;
+};
+
+// n processes arriving over [0, span) with mean burst `burst`
+static Workload generate(const std::string& dist, int n, int span, int burst, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> uniformArrival(0, std::max(0, span - 1));
+    std::uniform_int_distribution<int> uniformBurst(1, std::max(1, 2 * burst - 1));
+    std::uniform_int_distribution<int> prio(0, 9);
+    Workload w;
+    w.arrival.resize(n);
+    w.burst.resize(n);
+    w.priority.resize(n);
+
+    if (dist == "poisson") {
+        // Exponential gaps at rate n / span
+        std::exponential_distribution<double> gap(static_cast<double>(n) / std::max(1, span));
+        double t = 0;
+        for (int i = 0; i < n; ++i) {
+            t += gap(rng);
+            w.arrival[i] = static_cast<int>(t);
+        }
+    } else if (dist == "bursty") {
+        // Arrivals packed into ~sqrt(n) short clusters
+        int clusters = std::max(1, static_cast<int>(std::sqrt(n)));
+        std::vector<int> at(clusters);
+        for (int& c : at) c = uniformArrival(rng);
+        std::uniform_int_distribution<int> pick(0, clusters - 1), jitter(0, 4);
+        for (int i = 0; i < n; ++i) w.arrival[i] = at[pick(rng)] + jitter(rng);
+    } else {
+        for (int i = 0; i < n; ++i) w.arrival[i] = uniformArrival(rng);
+    }
+
+    if (dist == "heavy") {
+        // Pareto(alpha = 1.5) scaled to the requested mean, capped at 1000x
+        std::uniform_real_distribution<double> u(0.0, 1.0);
+        double xm = burst / 3.0;
+        for (int i = 0; i < n; ++i) {
+            double x = xm / std::pow(1.0 - u(rng), 1.0 / 1.5);
+            w.burst[i] = std::max(1, static_cast<int>(std::min(x, 1000.0 * burst)));
+        }
+    } else {
+        for (int i = 0; i < n; ++i) w.burst[i] = uniformBurst(rng);
+    }
+
+    for (int i = 0; i < n; ++i) w.priority[i] = prio(rng);
+    return w;
+}
+
+// -------------------- Policies --------------------
+struct Entry {
+    const char* name;
+    std::function<BinaryResult(const Workload&)> binary;
+    std::function<std::string(const Workload&)> json;
+};
+
+static std::vector<Entry> entries(int quantum) {
+    return {
+        { "fcfs",
+          [](const Workload& w) { return fcfs_schedule_binary(w.arrival, w.burst); },
+          [](const Workload& w) { return fcfs_schedule(w.arrival, w.burst); } },
+        { "rr",
+          [=](const Workload& w) { return rr_schedule_binary(w.arrival, w.burst, quantum); },
+          [=](const Workload& w) { return rr_schedule(w.arrival, w.burst, quantum); } },
+        { "sjf",
+          [](const Workload& w) { return sjf_schedule_binary(w.arrival, w.burst); },
+          [](const Workload& w) { return sjf_schedule(w.arrival, w.burst); } },
+        { "sjf-preemptive",
+          [](const Workload& w) { return sjf_preemptive_schedule_binary(w.arrival, w.burst); },
+          [](const Workload& w) { return sjf_preemptive_schedule(w.arrival, w.burst); } },
+        { "priority",
+          [](const Workload& w) { return priority_schedule_binary(w.arrival, w.burst, w.priority); },
+          [](const Workload& w) { return priority_schedule(w.arrival, w.burst, w.priority); } },
+        { "priority-preemptive",
+          [](const Workload& w) { return priority_preemptive_schedule_binary(w.arrival, w.burst, w.priority); },
+          [](const Workload& w) { return priority_preemptive_schedule(w.arrival, w.burst, w.priority); } },
+        { "mlfq",
+          [=](const Workload& w) { return mlfq_schedule_binary(w.arrival, w.burst, { quantum, 2 * quantum, 4 * quantum }, 0); },
+          [=](const Workload& w) { return mlfq_schedule(w.arrival, w.burst, { quantum, 2 * quantum, 4 * quantum }, 0); } },
+        { "cfs",
+          [](const Workload& w) { return cfs_schedule_binary(w.arrival, w.burst, w.priority, 0, 0); },
+          [](const Workload& w) { return cfs_schedule(w.arrival, w.burst, w.priority, 0, 0); } },
+    };
+}
+
+// -------------------- Measurement --------------------
+struct Sample {
+    double ms = 0;      // best of reps
+    size_t peak = 0;    // bytes above the heap level at the start of the run
+};
+
+template <typename F>
+static Sample measure(int reps, F&& run) {
+    Sample s;
+    s.ms = 1e300;
+    for (int r = 0; r < reps; ++r) {
+        size_t base = heapNow;
+        heapPeak = heapNow;
+        auto t0 = std::chrono::steady_clock::now();
+        run();
+        auto t1 = std::chrono::steady_clock::now();
+        s.ms = std::min(s.ms, std::chrono::duration<double, std::milli>(t1 - t0).count());
+        s.peak = std::max(s.peak, heapPeak - base);
+    }
+    return s;
+}
+
+static std::vector<std::string> splitList(const std::string& s) {
+    std::vector<std::string> out;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) out.push_back(item);
+    return out;
+}
+
+int main(int argc, char** argv) {
+    std::vector<std::string> sizes = { "1000", "10000" };
+    std::vector<std::string> dists = { "uniform", "poisson", "heavy", "bursty" };
+    int span = 100000, burst = 10, reps = 3, quantum = 4, jsonLimit = 2000;
+    unsigned seed = 1;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i], val = argv[i + 1];
+        if (arg == "--n") sizes = splitList(val);
+        else if (arg == "--dist") dists = splitList(val);
+        else if (arg == "--span") span = std::atoi(val.c_str());
+        else if (arg == "--burst") burst = std::atoi(val.c_str());
+        else if (arg == "--reps") reps = std::max(1, std::atoi(val.c_str()));
+        else if (arg == "--quantum") quantum = std::max(1, std::atoi(val.c_str()));
+        else if (arg == "--json-limit") jsonLimit = std::atoi(val.c_str());
+        else if (arg == "--seed") seed = static_cast<unsigned>(std::atoi(val.c_str()));
+        else {
+            std::fprintf(stderr, "bench: unknown option %s\n", arg.c_str());
+            return 2;
+        }
+    }
+
+    std::printf("%-8s %-20s %8s %10s %10s %12s %10s %10s %10s\n",
+                "dist", "policy", "n", "sim_ms", "json_ms", "events", "Mevents/s", "sim_KB", "json_KB");
+
+    for (const auto& dist : dists) {
+        for (const auto& sz : sizes) {
+            int n = std::atoi(sz.c_str());
+            Workload w = generate(dist, n, span, burst, seed);
+            for (const auto& e : entries(quantum)) {
+                size_t events = 0;
+                Sample sim = measure(reps, [&] {
+                    BinaryResult r = e.binary(w);
+                    events = r.readyEvents.size() / BinaryResult::READY_FIELDS;
+                });
+
+                // JSON expands per-tick maps, so it is skipped for large runs
+                Sample json;
+                bool withJson = n <= jsonLimit;
+                if (withJson) json = measure(reps, [&] { volatile size_t len = e.json(w).size(); (void)len; });
+
+                std::printf("%-8s %-20s %8d %10.3f ", dist.c_str(), e.name, n, sim.ms);
+                if (withJson) std::printf("%10.3f ", std::max(0.0, json.ms - sim.ms));
+                else std::printf("%10s ", "-");
+                std::printf("%12zu %10.2f %10zu ", events, events / sim.ms / 1000.0, sim.peak / 1024);
+                if (withJson) std::printf("%10zu\n", json.peak / 1024);
+                else std::printf("%10s\n", "-");
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,239 @@
+#include <emscripten/bind.h>
+#include <emscripten/val.h>
+#include "Scheduler.h"
+#include "Incremental.h"
+#include "RealTime.h"
+#include "Io.h"
+#include "Smp.h"
+#include "Sweep.h"
+#include "Timeline.h"
+#include "Simulator.h"
+
+using namespace emscripten;
+
+// Int32Array over the vector's storage in WASM memory, no copy made. The
+// view is only valid until the result is deleted or the heap grows, so
+// callers that keep the data should slice() it.
+static val int32View(const std::vector<int32_t>& v) {
+    return val(typed_memory_view(v.size(), v.data()));
+}
+
+static val float64View(const std::vector<double>& v) {
+    return val(typed_memory_view(v.size(), v.data()));
+}
+
+// Single-workload sweep for the page; rows are workload 0 throughout
+static SweepTable rr_sweep_table(const std::vector<int>& arrival, const std::vector<int>& burst,
+                                 const std::vector<int>& quanta) {
+    return SweepTable(rr_sweep({ { arrival, burst } }, quanta));
+}
+
+EMSCRIPTEN_BINDINGS(scheduler_module) {
+    register_vector<int>("VectorInt");
+
+    value_object<Percentiles>("Percentiles")
+        .field("p50", &Percentiles::p50)
+        .field("p95", &Percentiles::p95)
+        .field("p99", &Percentiles::p99)
+        .field("max", &Percentiles::max);
+    value_object<Metrics>("Metrics")
+        .field("averageResponse", &Metrics::averageResponse)
+        .field("throughput", &Metrics::throughput)
+        .field("cpuUtilization", &Metrics::cpuUtilization)
+        .field("idle", &Metrics::idle)
+        .field("switchOverhead", &Metrics::switchOverhead)
+        .field("contextSwitches", &Metrics::contextSwitches)
+        .field("waiting", &Metrics::waiting)
+        .field("turnaround", &Metrics::turnaround)
+        .field("response", &Metrics::response);
+
+    class_<BinaryResult>("BinaryResult")
+        .property("averageTurnaround", &BinaryResult::averageTurnaround)
+        .property("averageWaiting", &BinaryResult::averageWaiting)
+        .property("contextSwitches", &BinaryResult::contextSwitches)
+        .property("maxWait", &BinaryResult::maxWait)
+        .property("metrics", &BinaryResult::metrics)
+        .function("processTable", optional_override([](const BinaryResult& r) { return int32View(r.processTable); }))
+        .function("segments", optional_override([](const BinaryResult& r) { return int32View(r.segments); }))
+        .function("readyEvents", optional_override([](const BinaryResult& r) { return int32View(r.readyEvents); }))
+        .function("rounds", optional_override([](const BinaryResult& r) { return int32View(r.rounds); }))
+        .function("roundPids", optional_override([](const BinaryResult& r) { return int32View(r.roundPids); }))
+        .function("completed", optional_override([](const BinaryResult& r) { return int32View(r.completed); }));
+    constant("PROCESS_FIELDS", BinaryResult::PROCESS_FIELDS);
+    constant("SEGMENT_FIELDS", BinaryResult::SEGMENT_FIELDS);
+    constant("READY_FIELDS", BinaryResult::READY_FIELDS);
+    constant("ROUND_FIELDS", BinaryResult::ROUND_FIELDS);
+    class_<TickTables>("TickTables")
+        .function("running", optional_override([](const TickTables& r) { return int32View(r.running); }))
+        .function("readyAt", optional_override([](const TickTables& r) { return int32View(r.readyAt); }))
+        .function("ready", optional_override([](const TickTables& r) { return int32View(r.ready); }));
+    constant("READY_AT_FIELDS", TickTables::READY_AT_FIELDS);
+    // Query results are views of one buffer the next query overwrites
+    class_<TimelineIndex>("TimelineIndex")
+        .function("makespan", &TimelineIndex::makespan)
+        .function("segments", optional_override([](TimelineIndex& x, int t0, int t1) { return int32View(x.segments(t0, t1)); }))
+        .function("runningAt", &TimelineIndex::runningAt)
+        .function("readyAt", optional_override([](TimelineIndex& x, int t) { return int32View(x.readyAt(t)); }))
+        .function("overview", optional_override([](TimelineIndex& x, int t0, int t1, int pixels) {
+            return int32View(x.overview(t0, t1, pixels));
+        }));
+    constant("OVERVIEW_FIELDS", TimelineIndex::OVERVIEW_FIELDS);
+    constant("SWITCH_PID", SWITCH_PID);
+
+    value_object<SwitchCost>("SwitchCost")
+        .field("fixed", &SwitchCost::fixed)
+        .field("cacheMax", &SwitchCost::cacheMax)
+        .field("cacheInterval", &SwitchCost::cacheInterval);
+
+    class_<ProcessInput>("ProcessInput")
+        .constructor<int>()
+        .function("size", &ProcessInput::size)
+        .function("arrival", optional_override([](const ProcessInput& in) { return int32View(in.arrival); }))
+        .function("burst", optional_override([](const ProcessInput& in) { return int32View(in.burst); }))
+        .function("priority", optional_override([](const ProcessInput& in) { return int32View(in.priority); }));
+
+    class_<IncrementalSchedule>("IncrementalSchedule")
+        .constructor<std::string, int>()
+        .function("size", &IncrementalSchedule::size)
+        .function("setProcess", &IncrementalSchedule::setProcess)
+        .function("setProcesses", &IncrementalSchedule::setProcesses)
+        .function("step", &IncrementalSchedule::step)
+        .function("cancel", &IncrementalSchedule::cancel)
+        .function("cancelled", &IncrementalSchedule::cancelled)
+        .function("progress", &IncrementalSchedule::progress)
+        .function("json", &IncrementalSchedule::json)
+        .function("binary", &IncrementalSchedule::binary)
+        .function("ticks", &IncrementalSchedule::ticks)
+        .function("index", &IncrementalSchedule::index)
+        .function("resumedFrom", &IncrementalSchedule::resumedFrom);
+
+    // run() fills tables read through views, so a run allocates nothing on
+    // either side of the boundary
+    class_<Simulator>("Simulator")
+        .constructor<std::string, int>()
+        .function("setPolicy", &Simulator::setPolicy)
+        .function("setSwitchCost", &Simulator::setSwitchCost)
+        .function("run", optional_override([](Simulator& s, const ProcessInput& input) { s.run(input); }))
+        .function("json", &Simulator::json)
+        .function("averageTurnaround", optional_override([](const Simulator& s) { return s.result().averageTurnaround; }))
+        .function("averageWaiting", optional_override([](const Simulator& s) { return s.result().averageWaiting; }))
+        .function("maxWait", optional_override([](const Simulator& s) { return s.result().maxWait; }))
+        .function("metrics", optional_override([](const Simulator& s) { return s.result().metrics; }))
+        .function("processTable", optional_override([](const Simulator& s) { return int32View(s.result().processTable); }))
+        .function("segments", optional_override([](const Simulator& s) { return int32View(s.result().segments); }))
+        .function("readyEvents", optional_override([](const Simulator& s) { return int32View(s.result().readyEvents); }))
+        .function("rounds", optional_override([](const Simulator& s) { return int32View(s.result().rounds); }))
+        .function("roundPids", optional_override([](const Simulator& s) { return int32View(s.result().roundPids); }))
+        .function("completed", optional_override([](const Simulator& s) { return int32View(s.result().completed); }));
+
+    value_object<SmpConfig>("SmpConfig")
+        .field("cores", &SmpConfig::cores)
+        .field("steal", &SmpConfig::steal)
+        .field("rebalanceInterval", &SmpConfig::rebalanceInterval);
+    class_<SmpResult>("SmpResult")
+        .property("averageTurnaround", &SmpResult::averageTurnaround)
+        .property("averageWaiting", &SmpResult::averageWaiting)
+        .property("cores", &SmpResult::cores)
+        .property("makespan", &SmpResult::makespan)
+        .property("migrations", &SmpResult::migrations)
+        .property("steals", &SmpResult::steals)
+        .property("metrics", &SmpResult::metrics)
+        .function("processTable", optional_override([](const SmpResult& r) { return int32View(r.processTable); }))
+        .function("segments", optional_override([](const SmpResult& r) { return int32View(r.segments); }))
+        .function("rounds", optional_override([](const SmpResult& r) { return int32View(r.rounds); }))
+        .function("roundPids", optional_override([](const SmpResult& r) { return int32View(r.roundPids); }))
+        .function("completed", optional_override([](const SmpResult& r) { return int32View(r.completed); }));
+    constant("CORE_SEGMENT_FIELDS", SmpResult::CORE_SEGMENT_FIELDS);
+    constant("CORE_ROUND_FIELDS", SmpResult::CORE_ROUND_FIELDS);
+
+    class_<SweepTable>("SweepTable")
+        .function("rows", optional_override([](const SweepTable& t) { return float64View(t.rows); }));
+    constant("SWEEP_FIELDS", SweepTable::SWEEP_FIELDS);
+
+    class_<RealTimeResult>("RealTimeResult")
+        .property("jobCount", &RealTimeResult::jobCount)
+        .property("misses", &RealTimeResult::misses)
+        .property("maxLateness", &RealTimeResult::maxLateness)
+        .property("averageLateness", &RealTimeResult::averageLateness)
+        .property("averageTardiness", &RealTimeResult::averageTardiness)
+        .property("utilization", &RealTimeResult::utilization)
+        .property("hyperperiod", &RealTimeResult::hyperperiod)
+        .property("repeatsFrom", &RealTimeResult::repeatsFrom)
+        .property("simulatedUntil", &RealTimeResult::simulatedUntil)
+        .function("jobs", optional_override([](const RealTimeResult& r) { return int32View(r.jobs); }))
+        .function("segments", optional_override([](const RealTimeResult& r) { return int32View(r.segments); }))
+        .function("tasks", optional_override([](const RealTimeResult& r) { return float64View(r.tasks); }));
+    constant("JOB_FIELDS", RealTimeResult::JOB_FIELDS);
+    constant("TASK_FIELDS", RealTimeResult::TASK_FIELDS);
+
+    class_<BurstInput>("BurstInput")
+        .constructor<int, int>()
+        .function("size", &BurstInput::size)
+        .function("arrival", optional_override([](const BurstInput& in) { return int32View(in.arrival); }))
+        .function("priority", optional_override([](const BurstInput& in) { return int32View(in.priority); }))
+        .function("first", optional_override([](const BurstInput& in) { return int32View(in.first); }))
+        .function("length", optional_override([](const BurstInput& in) { return int32View(in.length); }))
+        .function("device", optional_override([](const BurstInput& in) { return int32View(in.device); }));
+    class_<IoResult>("IoResult")
+        .property("averageTurnaround", &IoResult::averageTurnaround)
+        .property("averageWaiting", &IoResult::averageWaiting)
+        .property("makespan", &IoResult::makespan)
+        .property("metrics", &IoResult::metrics)
+        .function("processTable", optional_override([](const IoResult& r) { return int32View(r.processTable); }))
+        .function("segments", optional_override([](const IoResult& r) { return int32View(r.segments); }))
+        .function("rounds", optional_override([](const IoResult& r) { return int32View(r.rounds); }))
+        .function("roundPids", optional_override([](const IoResult& r) { return int32View(r.roundPids); }))
+        .function("deviceSegments", optional_override([](const IoResult& r) { return int32View(r.deviceSegments); }))
+        .function("completed", optional_override([](const IoResult& r) { return int32View(r.completed); }))
+        .function("deviceUtilization", optional_override([](const IoResult& r) { return float64View(r.deviceUtilization); }));
+    constant("DEVICE_SEGMENT_FIELDS", IoResult::DEVICE_SEGMENT_FIELDS);
+
+    function("fcfs_schedule", &fcfs_schedule);
+    function("fcfs_schedule_binary", &fcfs_schedule_binary);
+    function("rr_schedule", &rr_schedule);
+    function("rr_schedule_binary", &rr_schedule_binary);
+    function("rr_sweep", &rr_sweep_table);
+    function("sjf_schedule", &sjf_schedule);
+    function("sjf_preemptive_schedule", &sjf_preemptive_schedule);
+    function("sjf_schedule_binary", &sjf_schedule_binary);
+    function("sjf_preemptive_schedule_binary", &sjf_preemptive_schedule_binary);
+    function("priority_schedule", &priority_schedule);
+    function("priority_preemptive_schedule", &priority_preemptive_schedule);
+    function("priority_schedule_binary", &priority_schedule_binary);
+    function("priority_preemptive_schedule_binary", &priority_preemptive_schedule_binary);
+    function("priority_aging_schedule", &priority_aging_schedule);
+    function("priority_aging_schedule_binary", &priority_aging_schedule_binary);
+    function("switch_cost_schedule", &switch_cost_schedule);
+    function("switch_cost_schedule_binary", &switch_cost_schedule_binary);
+    function("mlfq_schedule", &mlfq_schedule);
+    function("mlfq_schedule_binary", &mlfq_schedule_binary);
+    function("cfs_schedule", &cfs_schedule);
+    function("cfs_schedule_binary", &cfs_schedule_binary);
+
+    function("fcfs_schedule_input", &fcfs_schedule_input);
+    function("fcfs_schedule_binary_input", &fcfs_schedule_binary_input);
+    function("rr_schedule_input", &rr_schedule_input);
+    function("rr_schedule_binary_input", &rr_schedule_binary_input);
+    function("sjf_schedule_input", &sjf_schedule_input);
+    function("sjf_preemptive_schedule_input", &sjf_preemptive_schedule_input);
+    function("sjf_schedule_binary_input", &sjf_schedule_binary_input);
+    function("sjf_preemptive_schedule_binary_input", &sjf_preemptive_schedule_binary_input);
+    function("priority_schedule_input", &priority_schedule_input);
+    function("priority_preemptive_schedule_input", &priority_preemptive_schedule_input);
+    function("priority_schedule_binary_input", &priority_schedule_binary_input);
+    function("priority_preemptive_schedule_binary_input", &priority_preemptive_schedule_binary_input);
+
+    function("fcfs_schedule_smp", &fcfs_schedule_smp);
+    function("rr_schedule_smp", &rr_schedule_smp);
+    function("sjf_schedule_smp", &sjf_schedule_smp);
+    function("sjf_preemptive_schedule_smp", &sjf_preemptive_schedule_smp);
+    function("priority_schedule_smp", &priority_schedule_smp);
+    function("priority_preemptive_schedule_smp", &priority_preemptive_schedule_smp);
+
+    function("io_schedule", optional_override([](const BurstInput& input, const std::string& policy, int quantum) {
+        return io_schedule(input, policy, quantum);
+    }));
+    function("io_switch_cost_schedule", &io_schedule);
+    function("edf_schedule", &edf_schedule);
+    function("rm_schedule", &rm_schedule);
+}
@@ -0,0 +1,135 @@
+#include "Scheduler.h"
+#include <vector>
+#include <string>
+#include <set>
+#include <cstdint>
+#include <algorithm>
+
+// Load weight per nice value -20..19, as in the Linux scheduler: each step
+// is roughly 10% more or less CPU, nice 0 weighs 1024
+static const int NICE_WEIGHT[40] = {
+    88761, 71755, 56483, 46273, 36291,
+    29154, 23254, 18705, 14949, 11916,
+     9548,  7620,  6100,  4904,  3906,
+     3121,  2501,  1991,  1586,  1277,
+     1024,   820,   655,   526,   423,
+      335,   272,   215,   172,   137,
+      110,    87,    70,    56,    45,
+       36,    29,    23,    18,    15,
+};
+
+static constexpr int NICE_0_WEIGHT = 1024;
+
+// Completely fair scheduling: runnable processes sit in a red-black tree
+// (std::set) keyed by virtual runtime, and the leftmost one runs next. A
+// process's vruntime grows by its run time scaled by NICE_0_WEIGHT / weight,
+// so heavier (lower nice) processes age slower and get more CPU. Each pick
+// runs for its weight's share of targetLatency, but never less than
+// minGranularity; with many runnable processes the period stretches to
+// nr * minGranularity. The priority column is the nice value, clamped to
+// -20..19. Arrivals join at the tree's minimum vruntime and preempt the
+// running process when they sort before it.
+class Cfs final : public Specialized<Cfs> {
+public:
+    Cfs(const std::vector<Process>& proc, int targetLatency, int minGranularity)
+        : proc(proc), targetLatency(targetLatency), minGranularity(minGranularity),
+          vruntime(proc.size(), -1) {}
+
+    bool empty() const override { return tree.empty(); }
+
+    void push(int i) override {
+        if (i == running) {
+            // Back from the CPU: charge the run, and keep the unused part of
+            // the slice if it was cut short by an arrival
+            int ran = ranFrom - proc[i].remaining;
+            vruntime[i] += int64_t(ran) * NICE_0_WEIGHT * SCALE / weight(i);
+            sliceUsed += ran;
+            running = -1;
+            if (sliceUsed >= sliceLen) sliceUsed = 0;
+            else carried = i;
+        } else {
+            vruntime[i] = std::max<int64_t>(vruntime[i], minVruntime);
+        }
+        tree.insert({ vruntime[i], i });
+        queuedWeight += weight(i);
+        updateMin();
+    }
+
+    int pop() override {
+        int i = tree.begin()->second;
+        tree.erase(tree.begin());
+        queuedWeight -= weight(i);
+
+        if (i != carried) {
+            int64_t nr = int64_t(tree.size()) + 1;
+            int64_t period = std::max<int64_t>(targetLatency, nr * minGranularity);
+            int64_t share = period * weight(i) / (queuedWeight + weight(i));
+            sliceLen = static_cast<int>(std::max<int64_t>({ share, minGranularity, 1 }));
+            sliceUsed = 0;
+        }
+        carried = -1;
+        running = i;
+        ranFrom = proc[i].remaining;
+        updateMin();
+        return i;
+    }
+
+    void finished(int i) override {
+        if (i == running) running = -1;
+    }
+
+    bool preemptive() const override { return true; }
+    int slice() const override { return sliceLen - sliceUsed; }
+    ReadyOrder readyOrder() const override { return ReadyOrder::ByPid; }
+
+    std::vector<int> queued() const override {
+        std::vector<int> out;
+        out.reserve(tree.size());
+        for (const auto& e : tree) out.push_back(e.second);
+        return out;
+    }
+
+private:
+    // vruntime carries SCALE extra fractional steps per tick of nice-0 time
+    static constexpr int64_t SCALE = 1024;
+
+    int weight(int i) const { return NICE_WEIGHT[std::clamp(proc[i].priority, -20, 19) + 20]; }
+
+    // min_vruntime only moves forward, tracking the smallest vruntime still
+    // runnable (the running process included)
+    void updateMin() {
+        int64_t lowest = INT64_MAX;
+        if (running != -1) lowest = vruntime[running];
+        if (!tree.empty()) lowest = std::min(lowest, tree.begin()->first);
+        if (lowest != INT64_MAX) minVruntime = std::max(minVruntime, lowest);
+    }
+
+    const std::vector<Process>& proc;
+    int targetLatency, minGranularity;
+    std::set<std::pair<int64_t, int>> tree;   // {vruntime, index}, leftmost runs next
+    std::vector<int64_t> vruntime;
+    int64_t minVruntime = 0;
+    int64_t queuedWeight = 0;
+    int running = -1, ranFrom = 0;             // last pick and its remaining time then
+    int sliceLen = 1, sliceUsed = 0;
+    int carried = -1;                          // cut short, resumes its slice if picked next
+};
+
+// Non-positive settings fall back to a 24-tick latency and 3-tick granularity
+static auto make_cfs(int targetLatency, int minGranularity) {
+    return [=](const std::vector<Process>& proc) {
+        return std::make_unique<Cfs>(proc, targetLatency > 0 ? targetLatency : 24, minGranularity > 0 ? minGranularity : 3);
+    };
+}
+
+std::string cfs_schedule(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority,
+                         int targetLatency, int minGranularity) {
+    return run_policy<std::string>(process_table(columns(arrival, burst, priority), true),
+                                   make_cfs(targetLatency, minGranularity), true);
+}
+
+BinaryResult cfs_schedule_binary(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority,
+                                 int targetLatency, int minGranularity) {
+    return run_policy<BinaryResult>(process_table(columns(arrival, burst, priority), true),
+                                    make_cfs(targetLatency, minGranularity));
+}
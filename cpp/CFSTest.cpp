@@ -0,0 +1,47 @@
+// CFS slices, nice weights and joins on small hand-worked schedules
+// (default 24-tick latency, 3-tick granularity)
+
+#include "Tests.h"
+#include "Scheduler.h"
+#include <vector>
+
+// Equal weights split the latency evenly
+static TestCase evenSlices("cfs even slices", [] {
+    BinaryResult r = cfs_schedule_binary({ 0, 0 }, { 24, 24 }, { 0, 0 }, 0, 0);
+    check(r.segments == std::vector<int32_t>{ 0, 12, 1, 12, 24, 2, 24, 36, 1, 36, 48, 2 }, "cfs halves the latency");
+});
+
+// Nice -5 weighs 3121 against nice 0's 1024, so while both run it gets
+// about three ticks for every one of the other's
+static TestCase weights("cfs nice weights", [] {
+    BinaryResult r = cfs_schedule_binary({ 0, 0 }, { 60, 60 }, { -5, 0 }, 0, 0);
+    int ran[3] = { 0, 0, 0 };
+    for (size_t i = 0; i < r.segments.size(); i += BinaryResult::SEGMENT_FIELDS)
+        if (r.segments[i + 1] <= 80) ran[r.segments[i + 2]] += r.segments[i + 1] - r.segments[i];
+    check(ran[1] == 60 && ran[2] == 20, "cfs shares by weight");
+    check(r.segments[1] == 18, "cfs heavier slice is its share of the latency");
+});
+
+// Past latency / granularity runnable processes the period stretches and
+// every slice is the granularity
+static TestCase granularity("cfs minimum granularity", [] {
+    std::vector<int> arrival(10, 0), burst(10, 6), nice(10, 0);
+    BinaryResult r = cfs_schedule_binary(arrival, burst, nice, 24, 3);
+    bool ok = r.segments.size() == 20 * BinaryResult::SEGMENT_FIELDS;
+    for (size_t i = 0; ok && i < r.segments.size(); i += BinaryResult::SEGMENT_FIELDS)
+        ok = r.segments[i + 1] - r.segments[i] == 3 && r.segments[i + 2] == int(i / 3 % 10) + 1;
+    check(ok, "cfs slices of the granularity in turn");
+});
+
+// A process that finishes mid-slice is let go; the next pick gets a fresh
+// slice sized for the processes still runnable, not the rest of the old one
+static TestCase finishesMidSlice("cfs finish mid-slice", [] {
+    BinaryResult r = cfs_schedule_binary({ 0, 0, 0 }, { 2, 30, 30 }, { 0, 0, 0 }, 0, 0);
+    check(r.segments == std::vector<int32_t>{ 0, 2, 1, 2, 14, 2, 14, 26, 3, 26, 38, 2, 38, 50, 3, 50, 56, 2, 56, 62, 3 },
+          "cfs after a finish mid-slice");
+
+    // An arrival joins at the minimum vruntime, runs ahead of the process
+    // it cut short and finishes inside its slice
+    r = cfs_schedule_binary({ 0, 5 }, { 40, 10 }, { 0, 0 }, 0, 0);
+    check(r.segments == std::vector<int32_t>{ 0, 5, 1, 5, 15, 2, 15, 50, 1 }, "cfs arrival finishes mid-slice");
+});
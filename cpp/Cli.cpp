@@ -0,0 +1,476 @@
+// Native batch runner: schedules every workload in the given CSV/JSONL
+// files and prints one result line per workload.
+//
+//   schedulr [--policy NAME] [--quantum N] [--levels Q0,Q1,...] [--boost N]
+//            [--latency N] [--granularity N] [--full] FILE...
+//   schedulr --quanta 1,2,4,8 [--threads N] FILE...
+//   schedulr --cores N [--no-steal] [--rebalance T] [--policy NAME] FILE...
+//   schedulr --switch-cost FIXED[,CACHE_MAX,CACHE_INTERVAL] [--policy NAME] FILE...
+//   schedulr --trace [--tick-ns N] [--policy NAME] TRACE...
+//   schedulr --trace-io [--tick-ns N] [--policy NAME] TRACE...
+//   schedulr --convert-trace TEXT BINARY
+//
+// CSV:   one workload per file, rows of "arrival,burst[,priority]"; a
+//        header row and lines starting with '#' are skipped.
+// JSONL: one workload per line, e.g.
+//        {"arrival":[0,2],"burst":[5,3],"priority":[1,0],"quantum":2}
+// "-" reads CSV from stdin. By default a CSV summary is written; --full
+// writes the same JSON document the browser gets, one line per workload.
+// --quanta sweeps round robin over every workload x quantum pair on all
+// cores (or --threads N) and prints one summary row per pair.
+// --cores runs the multiprocessor mode; its summary adds migration and steal
+// counts, and --full writes the per-core Gantt as intervals.
+// --switch-cost charges every context switch (see SwitchCost) and adds the
+// switching ticks to the summary; it also applies to --trace-io.
+// --trace reads each FILE as a perf sched / ftrace capture (see Trace.h),
+// one workload per file with each task's total CPU time as its burst;
+// --trace-io replays the tasks' CPU and sleep sequences through the CPU/I-O
+// engine instead. --convert-trace writes a text trace in the binary format.
+
+#include "Scheduler.h"
+#include "Smp.h"
+#include "Sweep.h"
+#include "Trace.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+struct Workload {
+    std::string source;
+    std::vector<int> arrival, burst, priority;
+    int quantum = -1;   // -1: use --quantum
+};
+
+static const char* POLICIES[] = {
+    "fcfs", "rr", "sjf", "sjf-preemptive", "priority", "priority-preemptive", "mlfq", "cfs"
+};
+
+// MLFQ per-level quanta and boost period (--levels, --boost)
+static std::vector<int> mlfqLevels = { 2, 4, 8 };
+static int mlfqBoost = 0;
+
+// CFS target latency and minimum granularity (--latency, --granularity);
+// 0 selects the engine defaults
+static int cfsLatency = 0, cfsGranularity = 0;
+
+// Priority aging step and interval (--aging STEP,INTERVAL); 0 = off
+static int agingStep = 0, agingInterval = 0;
+
+// Context switch cost (--switch-cost FIXED[,CACHE_MAX,CACHE_INTERVAL])
+static SwitchCost switchCost;
+
+// Trace input (--trace, --trace-io, --tick-ns)
+static bool traceInput = false, traceIo = false;
+static TraceOptions traceOptions;
+
+static ProcessInput processInput(const Workload& w) {
+    ProcessInput in(w.arrival.size());
+    in.arrival = w.arrival;
+    in.burst = w.burst;
+    in.priority = w.priority;
+    return in;
+}
+
+static bool knownPolicy(const std::string& name) {
+    for (const char* p : POLICIES)
+        if (name == p) return true;
+    return false;
+}
+
+static BinaryResult runBinary(const std::string& policy, const Workload& w, int quantum) {
+    if (switchCost.enabled()) return switch_cost_schedule_binary(processInput(w), policy, quantum, switchCost);
+    if (policy == "fcfs") return fcfs_schedule_binary(w.arrival, w.burst);
+    if (policy == "rr") return rr_schedule_binary(w.arrival, w.burst, quantum);
+    if (policy == "sjf") return sjf_schedule_binary(w.arrival, w.burst);
+    if (policy == "sjf-preemptive") return sjf_preemptive_schedule_binary(w.arrival, w.burst);
+    if (agingStep > 0 && (policy == "priority" || policy == "priority-preemptive"))
+        return priority_aging_schedule_binary(w.arrival, w.burst, w.priority, policy == "priority-preemptive", agingStep, agingInterval);
+    if (policy == "priority") return priority_schedule_binary(w.arrival, w.burst, w.priority);
+    if (policy == "mlfq") return mlfq_schedule_binary(w.arrival, w.burst, mlfqLevels, mlfqBoost);
+    if (policy == "cfs") return cfs_schedule_binary(w.arrival, w.burst, w.priority, cfsLatency, cfsGranularity);
+    return priority_preemptive_schedule_binary(w.arrival, w.burst, w.priority);
+}
+
+static std::string runJson(const std::string& policy, const Workload& w, int quantum) {
+    if (switchCost.enabled()) return switch_cost_schedule(processInput(w), policy, quantum, switchCost);
+    if (policy == "fcfs") return fcfs_schedule(w.arrival, w.burst);
+    if (policy == "rr") return rr_schedule(w.arrival, w.burst, quantum);
+    if (policy == "sjf") return sjf_schedule(w.arrival, w.burst);
+    if (policy == "sjf-preemptive") return sjf_preemptive_schedule(w.arrival, w.burst);
+    if (agingStep > 0 && (policy == "priority" || policy == "priority-preemptive"))
+        return priority_aging_schedule(w.arrival, w.burst, w.priority, policy == "priority-preemptive", agingStep, agingInterval);
+    if (policy == "priority") return priority_schedule(w.arrival, w.burst, w.priority);
+    if (policy == "mlfq") return mlfq_schedule(w.arrival, w.burst, mlfqLevels, mlfqBoost);
+    if (policy == "cfs") return cfs_schedule(w.arrival, w.burst, w.priority, cfsLatency, cfsGranularity);
+    return priority_preemptive_schedule(w.arrival, w.burst, w.priority);
+}
+
+static SmpResult runSmp(const std::string& policy, const Workload& w, int quantum, const SmpConfig& config) {
+    if (policy == "fcfs") return fcfs_schedule_smp(w.arrival, w.burst, config);
+    if (policy == "rr") return rr_schedule_smp(w.arrival, w.burst, quantum, config);
+    if (policy == "sjf") return sjf_schedule_smp(w.arrival, w.burst, config);
+    if (policy == "sjf-preemptive") return sjf_preemptive_schedule_smp(w.arrival, w.burst, config);
+    if (policy == "priority") return priority_schedule_smp(w.arrival, w.burst, w.priority, config);
+    return priority_preemptive_schedule_smp(w.arrival, w.burst, w.priority, config);
+}
+
+// {"process_table":[...],"cores":[[{"start","end","pid"},...],...],...}
+static void writeSmpJson(std::ostream& os, const SmpResult& r) {
+    os << "{\"process_table\":[";
+    const char* fields[] = { "pid", "arrival", "burst", "priority", "start", "end", "turnaround", "waiting" };
+    for (size_t i = 0; i < r.processTable.size(); i += SmpResult::PROCESS_FIELDS) {
+        os << (i ? ",{" : "{");
+        for (int f = 0; f < SmpResult::PROCESS_FIELDS; ++f)
+            os << (f ? "," : "") << "\"" << fields[f] << "\":" << r.processTable[i + f];
+        os << "}";
+    }
+    os << "],\"cores\":[";
+    // Round blocks are spelled out slice by slice where they sit among the
+    // core's segments
+    size_t s = 0, b = 0;
+    for (int c = 0; c < r.cores; ++c) {
+        os << (c ? ",[" : "[");
+        bool first = true;
+        auto segment = [&](int start, int end, int pid) {
+            os << (first ? "" : ",") << "{\"start\":" << start << ",\"end\":" << end << ",\"pid\":" << pid << "}";
+            first = false;
+        };
+        auto roundsBefore = [&](size_t at) {
+            for (; b < r.rounds.size() && r.rounds[b] == c && size_t(r.rounds[b + 6]) * SmpResult::CORE_SEGMENT_FIELDS == at;
+                 b += SmpResult::CORE_ROUND_FIELDS) {
+                int t = r.rounds[b + 1], quantum = r.rounds[b + 2];
+                for (int k = 0; k < r.rounds[b + 3]; ++k)
+                    for (int j = 0; j < r.rounds[b + 5]; ++j, t += quantum)
+                        segment(t, t + quantum, r.roundPids[r.rounds[b + 4] + j]);
+            }
+        };
+        for (; s < r.segments.size() && r.segments[s] == c; s += SmpResult::CORE_SEGMENT_FIELDS) {
+            roundsBefore(s);
+            segment(r.segments[s + 1], r.segments[s + 2], r.segments[s + 3]);
+        }
+        roundsBefore(s);
+        os << "]";
+    }
+    os << "],\"migrations\":" << r.migrations << ",\"steals\":" << r.steals
+       << ",\"average_turnaround\":" << r.averageTurnaround << ",\"average_waiting\":" << r.averageWaiting << "}";
+}
+
+// -------------------- Input --------------------
+// Whole cell as an int; std::stoi alone would take "12abc" or "1.5"
+static int parseInt(const std::string& cell) {
+    size_t used = 0;
+    int v = std::stoi(cell, &used);
+    if (cell.find_first_not_of(" \t\r", used) != std::string::npos) throw std::invalid_argument(cell);
+    return v;
+}
+
+// Empty string if the row can be scheduled, otherwise what is wrong with it
+static std::string badRow(int arrival, int burst) {
+    if (arrival < 0) return "arrival " + std::to_string(arrival) + " is negative";
+    if (burst <= 0) return "burst " + std::to_string(burst) + " is not positive";
+    return "";
+}
+
+static Workload readCsv(std::istream& in, const std::string& source) {
+    Workload w;
+    w.source = source;
+    std::string line;
+    int lineNo = 0;
+    while (std::getline(in, line)) {
+        lineNo++;
+        size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#') continue;
+        if (!std::isdigit(static_cast<unsigned char>(line[first])) && line[first] != '-') continue;  // header
+
+        std::vector<int> cols;
+        std::stringstream ss(line);
+        std::string cell;
+        while (std::getline(ss, cell, ',')) {
+            try {
+                cols.push_back(parseInt(cell));
+            } catch (const std::exception&) {
+                throw std::runtime_error(source + ":" + std::to_string(lineNo) + ": bad number '" + cell + "'");
+            }
+        }
+        if (cols.size() < 2)
+            throw std::runtime_error(source + ":" + std::to_string(lineNo) + ": expected arrival,burst[,priority]");
+        std::string bad = badRow(cols[0], cols[1]);
+        if (!bad.empty()) throw std::runtime_error(source + ":" + std::to_string(lineNo) + ": " + bad);
+        w.arrival.push_back(cols[0]);
+        w.burst.push_back(cols[1]);
+        w.priority.push_back(cols.size() > 2 ? cols[2] : 0);
+    }
+    return w;
+}
+
+// Integer array stored under "key" in a flat JSON object, empty if absent
+static std::vector<int> jsonInts(const std::string& line, const std::string& key) {
+    std::vector<int> out;
+    size_t k = line.find("\"" + key + "\"");
+    if (k == std::string::npos) return out;
+    size_t open = line.find('[', k);
+    size_t close = line.find(']', open);
+    if (open == std::string::npos || close == std::string::npos)
+        throw std::runtime_error("\"" + key + "\" is not an array");
+    std::stringstream ss(line.substr(open + 1, close - open - 1));
+    std::string cell;
+    while (std::getline(ss, cell, ','))
+        if (cell.find_first_not_of(" \t") != std::string::npos) out.push_back(parseInt(cell));
+    return out;
+}
+
+static int jsonInt(const std::string& line, const std::string& key, int fallback) {
+    size_t k = line.find("\"" + key + "\"");
+    if (k == std::string::npos) return fallback;
+    size_t colon = line.find(':', k);
+    size_t end = line.find_first_of(",}", colon);
+    return parseInt(line.substr(colon + 1, end == std::string::npos ? std::string::npos : end - colon - 1));
+}
+
+static std::vector<Workload> readJsonl(std::istream& in, const std::string& source) {
+    std::vector<Workload> out;
+    std::string line;
+    int lineNo = 0;
+    while (std::getline(in, line)) {
+        lineNo++;
+        if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+        Workload w;
+        w.source = source + ":" + std::to_string(lineNo);
+        try {
+            w.arrival = jsonInts(line, "arrival");
+            w.burst = jsonInts(line, "burst");
+            w.priority = jsonInts(line, "priority");
+            w.quantum = jsonInt(line, "quantum", -1);
+        } catch (const std::exception& e) {
+            throw std::runtime_error(w.source + ": " + e.what());
+        }
+        if (w.arrival.size() != w.burst.size())
+            throw std::runtime_error(w.source + ": arrival and burst differ in length");
+        for (size_t i = 0; i < w.arrival.size(); ++i) {
+            std::string bad = badRow(w.arrival[i], w.burst[i]);
+            if (!bad.empty()) throw std::runtime_error(w.source + ": process " + std::to_string(i + 1) + ": " + bad);
+        }
+        w.priority.resize(w.arrival.size(), 0);
+        out.push_back(std::move(w));
+    }
+    return out;
+}
+
+static bool endsWith(const std::string& s, const std::string& suffix) {
+    return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// Tasks of a trace as one workload, totals only
+static Workload readTrace(const std::string& path) {
+    TraceOptions options = traceOptions;
+    options.bursts = false;
+    ProcessInput in = read_trace(path, options).summary();
+    Workload w;
+    w.source = path;
+    w.arrival = std::move(in.arrival);
+    w.burst = std::move(in.burst);
+    w.priority = std::move(in.priority);
+    return w;
+}
+
+static std::vector<Workload> readFile(const std::string& path) {
+    if (traceInput) return { readTrace(path) };
+    if (path == "-") return { readCsv(std::cin, "stdin") };
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error(path + ": cannot open");
+    if (endsWith(path, ".jsonl") || endsWith(path, ".json")) return readJsonl(in, path);
+    return { readCsv(in, path) };
+}
+
+static std::vector<int> parseList(const std::string& s) {
+    std::vector<int> out;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) out.push_back(std::atoi(item.c_str()));
+    return out;
+}
+
+// -------------------- Sweep --------------------
+static void sweep(const std::vector<std::string>& files, const std::vector<int>& quanta, int threads) {
+    std::vector<Workload> loads;
+    for (const auto& file : files)
+        for (auto& w : readFile(file)) loads.push_back(std::move(w));
+
+    std::vector<RrWorkload> runs;
+    runs.reserve(loads.size());
+    for (const auto& w : loads) runs.push_back({ w.arrival, w.burst });
+
+    std::cout << "source,quantum,average_turnaround,average_waiting,average_response,context_switches\n";
+    for (const auto& r : rr_sweep(runs, quanta, threads)) {
+        std::cout << loads[r.workload].source << "," << r.quantum << "," << r.averageTurnaround << ","
+                  << r.averageWaiting << "," << r.averageResponse << "," << r.contextSwitches << "\n";
+    }
+}
+
+// The metrics columns of the CSV summary
+static void writeMetrics(std::ostream& os, const Metrics& m) {
+    os << m.averageResponse << "," << m.waiting.p95 << "," << m.turnaround.p99 << ","
+       << m.throughput << "," << m.cpuUtilization << "," << m.contextSwitches;
+}
+
+// -------------------- Main --------------------
+static int usage() {
+    std::cerr << "usage: schedulr [--policy NAME] [--quantum N] [--levels Q0,Q1,...] [--boost N]\n"
+              << "                [--latency N] [--granularity N] [--aging STEP,INTERVAL] [--full] FILE...\n"
+              << "       schedulr --quanta Q1,Q2,... [--threads N] FILE...\n"
+              << "       schedulr --cores N [--no-steal] [--rebalance T] [--policy NAME] [--full] FILE...\n"
+              << "       schedulr --switch-cost FIXED[,CACHE_MAX,CACHE_INTERVAL] [--policy NAME] [--full] FILE...\n"
+              << "       schedulr --trace|--trace-io [--tick-ns N] [--policy NAME] TRACE...\n"
+              << "       schedulr --convert-trace TEXT BINARY\n"
+              << "policies:";
+    for (const char* p : POLICIES) std::cerr << " " << p;
+    std::cerr << "\n";
+    return 2;
+}
+
+int main(int argc, char** argv) {
+    std::string policy = "fcfs";
+    int quantum = 2;
+    bool full = false;
+    std::vector<int> quanta;
+    int threads = 0;
+    SmpConfig smp;
+    smp.cores = 0;   // 0: single-CPU engines
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--policy" && i + 1 < argc) policy = argv[++i];
+        else if (arg == "--quantum" && i + 1 < argc) quantum = std::atoi(argv[++i]);
+        else if (arg == "--quanta" && i + 1 < argc) quanta = parseList(argv[++i]);
+        else if (arg == "--threads" && i + 1 < argc) threads = std::atoi(argv[++i]);
+        else if (arg == "--levels" && i + 1 < argc) mlfqLevels = parseList(argv[++i]);
+        else if (arg == "--boost" && i + 1 < argc) mlfqBoost = std::atoi(argv[++i]);
+        else if (arg == "--latency" && i + 1 < argc) cfsLatency = std::atoi(argv[++i]);
+        else if (arg == "--granularity" && i + 1 < argc) cfsGranularity = std::atoi(argv[++i]);
+        else if (arg == "--aging" && i + 1 < argc) {
+            std::vector<int> aging = parseList(argv[++i]);
+            if (aging.size() != 2 || aging[0] < 1 || aging[1] < 1) return usage();
+            agingStep = aging[0];
+            agingInterval = aging[1];
+        }
+        else if (arg == "--switch-cost" && i + 1 < argc) {
+            std::vector<int> cost = parseList(argv[++i]);
+            if ((cost.size() != 1 && cost.size() != 3) || cost[0] < 0) return usage();
+            switchCost.fixed = cost[0];
+            if (cost.size() == 3) {
+                if (cost[1] < 0 || cost[2] < 0) return usage();
+                switchCost.cacheMax = cost[1];
+                switchCost.cacheInterval = cost[2];
+            }
+        }
+        else if (arg == "--trace") traceInput = true;
+        else if (arg == "--trace-io") traceInput = traceIo = true;
+        else if (arg == "--tick-ns" && i + 1 < argc) traceOptions.tickNs = std::atoll(argv[++i]);
+        else if (arg == "--convert-trace" && i + 2 < argc) {
+            try {
+                long long events = convert_trace(argv[i + 1], argv[i + 2]);
+                std::cerr << "schedulr: wrote " << events << " events to " << argv[i + 2] << "\n";
+            } catch (const std::exception& e) {
+                std::cerr << "schedulr: " << e.what() << "\n";
+                return 1;
+            }
+            return 0;
+        }
+        else if (arg == "--cores" && i + 1 < argc) smp.cores = std::atoi(argv[++i]);
+        else if (arg == "--no-steal") smp.steal = false;
+        else if (arg == "--rebalance" && i + 1 < argc) smp.rebalanceInterval = std::atoi(argv[++i]);
+        else if (arg == "--full") full = true;
+        else if (arg == "-h" || arg == "--help") return usage();
+        else files.push_back(arg);
+    }
+    if (files.empty() || !knownPolicy(policy) || quantum < 1) return usage();
+    for (int q : quanta)
+        if (q < 1) return usage();
+    if (smp.cores < 0 || smp.rebalanceInterval < 0) return usage();
+    if (smp.cores > 0 && (policy == "mlfq" || policy == "cfs" || agingStep > 0)) {
+        std::cerr << "schedulr: --cores does not support " << (agingStep > 0 ? "--aging" : policy) << "\n";
+        return 2;
+    }
+    if (traceOptions.tickNs < 1) return usage();
+    if (traceIo && (smp.cores > 0 || full || !quanta.empty() || policy == "mlfq" || policy == "cfs" || agingStep > 0)) {
+        std::cerr << "schedulr: --trace-io only prints the summary of the single-CPU classic policies\n";
+        return 2;
+    }
+    if (switchCost.enabled() && (smp.cores > 0 || policy == "mlfq" || policy == "cfs" || agingStep > 0)) {
+        std::cerr << "schedulr: --switch-cost does not support "
+                  << (smp.cores > 0 ? "--cores" : agingStep > 0 ? "--aging" : policy) << "\n";
+        return 2;
+    }
+
+    std::ios::sync_with_stdio(false);
+    if (!quanta.empty()) {
+        try {
+            sweep(files, quanta, threads);
+        } catch (const std::exception& e) {
+            std::cerr << "schedulr: " << e.what() << "\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    if (!full) {
+        std::cout << "source,policy,processes,average_turnaround,average_waiting,makespan,"
+                  << "average_response,p95_waiting,p99_turnaround,throughput,cpu_utilization,context_switches";
+        std::cout << (smp.cores > 0 ? ",cores,migrations,steals\n" : switchCost.enabled() ? ",switch_overhead\n" : "\n");
+    }
+
+    try {
+        for (const auto& file : files) {
+            if (traceIo) {
+                TraceWorkload t = read_trace(file, traceOptions);
+                IoResult r = io_schedule(t.input, policy, quantum, switchCost);
+                std::cout << file << "," << policy << "," << t.input.size() << ","
+                          << r.averageTurnaround << "," << r.averageWaiting << "," << r.makespan << ",";
+                writeMetrics(std::cout, r.metrics);
+                if (switchCost.enabled()) std::cout << "," << r.metrics.switchOverhead;
+                std::cout << "\n";
+                continue;
+            }
+            for (const auto& w : readFile(file)) {
+                int q = w.quantum > 0 ? w.quantum : quantum;
+                if (smp.cores > 0) {
+                    SmpResult r = runSmp(policy, w, q, smp);
+                    if (full) {
+                        writeSmpJson(std::cout, r);
+                        std::cout << "\n";
+                    } else {
+                        std::cout << w.source << "," << policy << "," << w.arrival.size() << ","
+                                  << r.averageTurnaround << "," << r.averageWaiting << "," << r.makespan << ",";
+                        writeMetrics(std::cout, r.metrics);
+                        std::cout << "," << r.cores << "," << r.migrations << "," << r.steals << "\n";
+                    }
+                    continue;
+                }
+                if (full) {
+                    std::cout << runJson(policy, w, q) << "\n";
+                    continue;
+                }
+                BinaryResult r = runBinary(policy, w, q);
+                int makespan = 0;
+                for (size_t j = 5; j < r.processTable.size(); j += BinaryResult::PROCESS_FIELDS)
+                    makespan = std::max(makespan, r.processTable[j]);
+                std::cout << w.source << "," << policy << "," << w.arrival.size() << ","
+                          << r.averageTurnaround << "," << r.averageWaiting << "," << makespan << ",";
+                writeMetrics(std::cout, r.metrics);
+                if (switchCost.enabled()) std::cout << "," << r.metrics.switchOverhead;
+                std::cout << "\n";
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "schedulr: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -1,162 +1,52 @@
-#include <emscripten/bind.h>
+#include "Scheduler.h"
+#include "Smp.h"
 #include <vector>
 #include <string>
-#include <sstream>
-#include <iomanip>
-#include <map>
 #include <algorithm>
 
 using namespace std;
-using namespace emscripten;
 
-struct Process {
-    int pid;
-    int arrival;
-    int burst;
-    int start = -1;
-    int end = -1;
-    int turnaround = -1;
-    int waiting = -1;
+// First come, first served: the ready queue is a plain FIFO and a process
+// keeps the CPU until it finishes
+class Fcfs final : public Specialized<Fcfs, FifoPolicy> {
+public:
+    bool listsDispatched() const override { return true; }
 };
 
-string fcfs_schedule(vector<int> arrival, vector<int> burst) {
-    int n = arrival.size();
-    vector<Process> processes(n);
-    vector<pair<int, int>> timeline;         // {time, pid}
-    map<int, vector<int>> readyQueue;        // {time, [pids]}
-    map<int, int> running;                   // {time, pid}
-    vector<int> completed;
+unique_ptr<Policy> fcfs_policy() { return make_unique<Fcfs>(); }
 
-    for (int i = 0; i < n; ++i) {
-        processes[i] = { i + 1, arrival[i], burst[i] };
-    }
-
-    sort(processes.begin(), processes.end(), [](const Process& a, const Process& b) {
-        return a.arrival < b.arrival;
+void sort_by_arrival(vector<Process>& proc) {
+    sort(proc.begin(), proc.end(), [](const Process& a, const Process& b) {
+        return a.arrival != b.arrival ? a.arrival < b.arrival : a.pid < b.pid;
     });
+}
 
-    int currentTime = 0;
-    int completedCount = 0;
-    double totalTurnaround = 0, totalWaiting = 0;
-    Process* current = nullptr;
-
-    while (completedCount < n) {
-        // Build ready queue: all arrived and not yet started
-        vector<int> rq;
-        for (const auto& p : processes) {
-            if (p.arrival <= currentTime && p.start == -1) {
-                rq.push_back(p.pid);
-            }
-        }
-        readyQueue[currentTime] = rq;
-
-        // If CPU is idle, schedule next in FCFS
-        if (!current && !rq.empty()) {
-            for (auto& p : processes) {
-                if (p.pid == rq[0]) {
-                    p.start = currentTime;
-                    p.end = p.start + p.burst;
-                    p.turnaround = p.end - p.arrival;
-                    p.waiting = p.start - p.arrival;
-                    totalTurnaround += p.turnaround;
-                    totalWaiting += p.waiting;
-                    current = &p;
-
-                    timeline.emplace_back(currentTime, p.pid);
-                    break;
-                }
-            }
-        }
-
-        // Mark running process
-        if (current) {
-            running[currentTime] = current->pid;
-            if (currentTime + 1 == current->end) {
-                completed.push_back(current->pid);
-                current = nullptr;
-                completedCount++;
-            }
-        }
-
-        currentTime++;
-    }
-
-    // Serialize output
-    ostringstream oss;
-    oss << "{";
-
-    // Process table
-    oss << "\"process_table\":[";
-    for (int i = 0; i < n; ++i) {
-        const auto& p = processes[i];
-        oss << "{"
-            << "\"pid\":" << p.pid << ","
-            << "\"arrival\":" << p.arrival << ","
-            << "\"burst\":" << p.burst << ","
-            << "\"start\":" << p.start << ","
-            << "\"end\":" << p.end << ","
-            << "\"turnaround\":" << p.turnaround << ","
-            << "\"waiting\":" << p.waiting
-            << "}";
-        if (i != n - 1) oss << ",";
-    }
-    oss << "],";
-
-    // Timeline
-    oss << "\"timeline\":[";
-    for (size_t i = 0; i < timeline.size(); ++i) {
-        oss << "{"
-            << "\"time\":" << timeline[i].first << ","
-            << "\"pid\":" << timeline[i].second
-            << "}";
-        if (i != timeline.size() - 1) oss << ",";
-    }
-    oss << "],";
-
-    // Ready queue
-    oss << "\"ready_queue\":{";
-    for (auto it = readyQueue.begin(); it != readyQueue.end(); ++it) {
-        oss << "\"" << it->first << "\":[";
-        for (size_t j = 0; j < it->second.size(); ++j) {
-            oss << it->second[j];
-            if (j != it->second.size() - 1) oss << ",";
-        }
-        oss << "]";
-        auto next = it;
-        ++next;
-        if (next != readyQueue.end()) oss << ",";
-    }
-    oss << "},";
+// Process table sorted by arrival, the order FCFS serves it in
+static vector<Process> fcfs_processes(const ProcessColumns& in) {
+    vector<Process> processes = process_table(in);
+    sort_by_arrival(processes);
+    return processes;
+}
 
-    // Running process
-    oss << "\"running_process\":{";
-    for (auto it = running.begin(); it != running.end(); ++it) {
-        oss << "\"" << it->first << "\":" << it->second;
-        auto next = it;
-        ++next;
-        if (next != running.end()) oss << ",";
-    }
-    oss << "},";
+static unique_ptr<Policy> make_fcfs(const vector<Process>&) { return fcfs_policy(); }
 
-    // Completed list
-    oss << "\"completed\":[";
-    for (size_t i = 0; i < completed.size(); ++i) {
-        oss << completed[i];
-        if (i != completed.size() - 1) oss << ",";
-    }
-    oss << "],";
+string fcfs_schedule(const vector<int>& arrival, const vector<int>& burst) {
+    return run_policy<string>(fcfs_processes(columns(arrival, burst)), make_fcfs);
+}
 
-    // Averages
-    oss << fixed << setprecision(2);
-    oss << "\"average_turnaround\":" << (totalTurnaround / n) << ",";
-    oss << "\"average_waiting\":" << (totalWaiting / n);
+BinaryResult fcfs_schedule_binary(const vector<int>& arrival, const vector<int>& burst) {
+    return run_policy<BinaryResult>(fcfs_processes(columns(arrival, burst)), make_fcfs);
+}
 
-    oss << "}";
+string fcfs_schedule_input(const ProcessInput& input) {
+    return run_policy<string>(fcfs_processes(input.columns()), make_fcfs);
+}
 
-    return oss.str();
+BinaryResult fcfs_schedule_binary_input(const ProcessInput& input) {
+    return run_policy<BinaryResult>(fcfs_processes(input.columns()), make_fcfs);
 }
 
-EMSCRIPTEN_BINDINGS(scheduling_module) {
-    register_vector<int>("VectorInt");
-    emscripten::function("fcfs_schedule", &fcfs_schedule);
+SmpResult fcfs_schedule_smp(const vector<int>& arrival, const vector<int>& burst, const SmpConfig& config) {
+    vector<Process> processes = fcfs_processes(columns(arrival, burst));
+    return simulate_smp(processes, config, fcfs_policy);
 }
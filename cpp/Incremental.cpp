@@ -0,0 +1,151 @@
+#include "Incremental.h"
+#include <algorithm>
+
+void Checkpoints::save(const std::vector<Process>& proc, const Policy& policy, const Schedule& sched,
+                       const ArrivalCursor& arrivals, const LoopState& state) {
+    if (!saved.empty() && ++sinceLast < std::max(MIN_SPACING, saved.back().live.size())) return;
+    sinceLast = 0;
+
+    Checkpoint c{ state, arrivals.position(), policy.clone(), {}, sched.mark() };
+    for (int i : policy.queued()) c.live.emplace_back(i, proc[i]);
+    saved.push_back(std::move(c));
+}
+
+void save_checkpoint(Checkpoints& saves, const std::vector<Process>& proc, const Policy& policy,
+                     const Schedule& sched, const ArrivalCursor& arrivals, const LoopState& state) {
+    saves.save(proc, policy, sched, arrivals, state);
+}
+
+const Checkpoint& Checkpoints::rewindTo(int t) {
+    // Everything admitted by a checkpoint arrived at or before its clock, so
+    // one taken strictly before t has not seen the edited process. The first
+    // checkpoint is the empty start of the run and always qualifies.
+    auto it = std::lower_bound(saved.begin() + 1, saved.end(), t,
+        [](const Checkpoint& c, int time) { return c.state.t < time; });
+    saved.erase(it, saved.end());
+    sinceLast = 0;
+    return saved.back();
+}
+
+IncrementalSchedule::IncrementalSchedule(const std::string& policy, int quantum)
+    : name(policy), quantum(quantum), withPriority(policy == "priority" || policy == "priority-preemptive"),
+      policy(policy_by_name(policy, proc, quantum)),
+      sched(this->policy->readyOrder(), this->policy->readyLog(), this->policy->listsDispatched()) {}
+
+void IncrementalSchedule::setProcess(int index, int arrival, int burst, int priority) {
+    if (index < 0 || index > size()) throw std::out_of_range("process index out of range");
+    if (!withPriority) priority = 0;   // listed as 0 like the other entry points
+    if (index == size()) {
+        proc.push_back({ index + 1, arrival, burst, priority, burst });
+        place(index);
+        dirtyFrom = std::min(dirtyFrom, arrival);
+        return;
+    }
+    Process& p = proc[index];
+    if (p.arrival == arrival && p.burst == burst && p.priority == priority) return;
+    dirtyFrom = std::min({ dirtyFrom, p.arrival, arrival });
+    if (p.arrival != arrival) {
+        order.erase(std::find(order.begin(), order.end(), index));
+        p.arrival = arrival;
+        place(index);
+    }
+    p.burst = burst;
+    p.priority = priority;
+}
+
+void IncrementalSchedule::setProcesses(const ProcessInput& input) {
+    ProcessColumns in = input.columns();
+    for (int i = 0; i < in.n; ++i) setProcess(i, in.arrival[i], in.burst[i], in.priority[i]);
+}
+
+void IncrementalSchedule::place(int index) {
+    auto at = std::lower_bound(order.begin(), order.end(), index, [&](int a, int b) {
+        return proc[a].arrival != proc[b].arrival ? proc[a].arrival < proc[b].arrival : a < b;
+    });
+    order.insert(at, index);
+}
+
+void IncrementalSchedule::begin() {
+    if (ran && dirtyFrom == INT_MAX) return;
+
+    // An empty table never reaches a checkpoint, so it starts over too
+    if (!ran || saves.size() == 0) {
+        for (auto& p : proc) p = { p.pid, p.arrival, p.burst, p.priority, p.burst };
+        policy = policy_by_name(name, proc, quantum);
+        sched = Schedule(policy->readyOrder(), policy->readyLog(), policy->listsDispatched());
+        state = LoopState();
+        saves.clear();
+        arrivals.emplace(proc, order);
+        ran = true;
+        running = true;
+        resumed = 0;
+        dirtyFrom = INT_MAX;
+        return;
+    }
+
+    const Checkpoint& c = saves.rewindTo(dirtyFrom);
+    sched.rewind(c.mark);
+
+    // Processes finished by the checkpoint keep their results; the queued
+    // ones go back to their saved progress and the rest start over
+    std::vector<char> done(proc.size(), 0);
+    for (int pid : sched.completed) done[pid - 1] = 1;
+    for (size_t i = 0; i < proc.size(); ++i) {
+        Process& p = proc[i];
+        if (!done[i]) p = { p.pid, p.arrival, p.burst, p.priority, p.burst };
+    }
+    for (const auto& [i, p] : c.live) proc[i] = p;
+
+    policy = c.policy->clone();
+    state = c.state;
+    resumed = state.t;
+    arrivals.emplace(proc, order);
+    arrivals->seek(c.admitted);
+    running = true;
+    dirtyFrom = INT_MAX;
+}
+
+bool IncrementalSchedule::step(int events) {
+    begin();
+    stoppedByCancel = false;
+    if (running) {
+        RunLimit limit{ events, &cancelRequested };
+        simulate(proc, *policy, sched, *arrivals, state, &saves, {}, limit);
+        running = state.completed < size();
+    }
+    stoppedByCancel = cancelRequested.exchange(false, std::memory_order_relaxed) && running;
+    return !running;
+}
+
+void IncrementalSchedule::update() {
+    while (!step(INT_MAX)) {}
+}
+
+// FCFS lists its table by arrival, like fcfs_schedule
+std::vector<Process> IncrementalSchedule::byArrival() const {
+    std::vector<Process> out = proc;
+    sort_by_arrival(out);
+    return out;
+}
+
+std::string IncrementalSchedule::json() {
+    update();
+    if (name == "fcfs") return to_json(byArrival(), sched);
+    return to_json(proc, sched, withPriority);
+}
+
+BinaryResult IncrementalSchedule::binary() {
+    update();
+    if (name == "fcfs") return BinaryResult(byArrival(), sched);
+    return BinaryResult(proc, sched);
+}
+
+TickTables IncrementalSchedule::ticks() {
+    update();
+    return TickTables(sched);
+}
+
+TimelineIndex IncrementalSchedule::index() {
+    update();
+    return TimelineIndex(sched);
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Scheduler.h"
+#include "Timeline.h"
+#include <vector>
+#include <string>
+#include <memory>
+#include <utility>
+#include <climits>
+#include <atomic>
+#include <optional>
+
+// Re-simulation after small edits. simulate() leaves checkpoints behind as it
+// runs; when a process changes, the run resumes from the last checkpoint
+// taken before anything involving that process happened, and only the rest
+// of the timeline is recomputed.
+
+// Loop state part way through a run. Resuming from it reproduces the rest
+// of the run exactly as long as no process admitted by then has changed.
+struct Checkpoint {
+    LoopState state;
+    size_t admitted;                            // arrival cursor position
+    std::unique_ptr<Policy> policy;             // copy of the ready queue
+    std::vector<std::pair<int, Process>> live;  // progress of queued processes
+    Schedule::Mark mark;
+};
+
+class Checkpoints {
+public:
+    // Fewest loop iterations between two checkpoints. The spacing also grows
+    // with the queue, so copying queues costs O(1) per iteration on average.
+    static constexpr size_t MIN_SPACING = 64;
+
+    void save(const std::vector<Process>& proc, const Policy& policy, const Schedule& sched,
+              const ArrivalCursor& arrivals, const LoopState& state);
+
+    // Latest checkpoint unaffected by changes to processes arriving at or
+    // after t; later checkpoints are dropped. Requires at least one save.
+    const Checkpoint& rewindTo(int t);
+
+    void clear() {
+        saved.clear();
+        sinceLast = 0;
+    }
+    size_t size() const { return saved.size(); }
+
+private:
+    std::vector<Checkpoint> saved;
+    size_t sinceLast = 0;
+};
+
+// A process table that is edited in place and rescheduled on demand.
+// Policy names are the ones the CLI takes: fcfs, rr, sjf, sjf-preemptive,
+// priority, priority-preemptive.
+class IncrementalSchedule {
+public:
+    IncrementalSchedule(const std::string& policy, int quantum);
+
+    int size() const { return static_cast<int>(proc.size()); }
+
+    // Sets process `index`; index == size() appends. Unchanged values are
+    // not an edit, so callers can resend the whole table.
+    void setProcess(int index, int arrival, int burst, int priority);
+
+    // setProcess() for every row of `input`, read in place
+    void setProcesses(const ProcessInput& input);
+
+    // Runs at most `events` loop iterations of the update the edits call
+    // for; true once the results are current. A run left part way is picked
+    // up by the next call, and edits made in between rewind it like any
+    // other, so callers can yield between chunks.
+    bool step(int events);
+
+    // Makes a step() in progress on another thread, or the next one, return
+    // early; the run stays where it stopped
+    void cancel() { cancelRequested.store(true, std::memory_order_relaxed); }
+    bool cancelled() const { return stoppedByCancel; }
+
+    // Share of the processes finished so far in the current run
+    double progress() const { return proc.empty() ? 1.0 : double(state.completed) / proc.size(); }
+
+    // Results for the current table, re-simulated from a checkpoint if needed
+    std::string json();
+    BinaryResult binary();
+    TickTables ticks();
+    TimelineIndex index();
+
+    // Clock value the last update resumed from (0 for a run from the start)
+    int resumedFrom() const { return resumed; }
+
+private:
+    void update();
+    void begin();                         // sets up the run the edits call for
+    std::vector<Process> byArrival() const;
+    void place(int index);                // inserts index into `order`
+
+    std::string name;
+    int quantum;
+    bool withPriority;                    // the policy reads priorities
+    std::vector<Process> proc;            // input order, pid = index + 1
+    std::vector<int> order;               // indices by (arrival, index), kept across edits
+    std::unique_ptr<Policy> policy;
+    Schedule sched;
+    LoopState state;
+    Checkpoints saves;
+    std::optional<ArrivalCursor> arrivals;
+    bool ran = false;
+    bool running = false;                 // a run was set up and has not finished
+    int dirtyFrom = INT_MAX;              // earliest arrival touched by an edit
+    int resumed = 0;
+    std::atomic<bool> cancelRequested{ false };
+    bool stoppedByCancel = false;
+};
@@ -0,0 +1,184 @@
+#include "Io.h"
+#include <queue>
+#include <deque>
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+
+namespace {
+
+struct Device {
+    std::deque<int> queue;    // blocked processes waiting for service
+    int serving = -1;
+    long long busy = 0;
+};
+
+}  // namespace
+
+// Checks the offsets and sets up one process per row, its CPU burst still
+// empty
+static std::vector<Process> io_processes(const BurstInput& in) {
+    int n = in.size();
+    if (in.first.size() != size_t(n) + 1 || in.first[0] != 0 || in.first[n] != static_cast<int>(in.length.size()))
+        throw std::invalid_argument("burst offsets must run from 0 to the number of bursts");
+    std::vector<Process> proc(n);
+    for (int i = 0; i < n; ++i) {
+        if (in.first[i + 1] < in.first[i]) throw std::invalid_argument("burst offsets must not decrease");
+        proc[i] = { i + 1, in.arrival[i], 0, in.priority[i], 0 };
+    }
+    return proc;
+}
+
+// The blocked side of a CPU/I-O run; the CPU side is simulate()'s own loop,
+// which hands every arrival and finished CPU burst to moveOn(). Processes
+// hold their current CPU burst in burst/remaining so the single-CPU policies
+// rank them as usual.
+class IoSimulation : public BlockedSet {
+public:
+    IoSimulation(const BurstInput& in, const std::string& name, int quantum)
+        : in(in), proc(io_processes(in)), next(in.first.begin(), in.first.end() - 1), cpuTotal(in.size(), 0), blocked(in.size(), 0),
+          blockedSince(in.size(), 0), policy(policy_by_name(name, proc, quantum)),
+          sched(policy->readyOrder(), policy->readyLog(), policy->listsDispatched()) {
+        int devices = 0;
+        for (int i = 0; i < in.size(); ++i) {
+            for (int k = in.first[i]; k < in.first[i + 1]; ++k) {
+                if (in.device[k] == BurstInput::CPU) cpuTotal[i] += std::max(0, in.length[k]);
+                else if (in.device[k] >= 0) devices = std::max(devices, in.device[k] + 1);
+                else if (in.device[k] != BurstInput::SLEEP) throw std::invalid_argument("unknown device code");
+            }
+        }
+        device.resize(devices);
+    }
+
+    IoResult run(const SwitchCost& cost);
+
+    int nextTime() const override { return done.empty() ? INT_MAX : done.top().first; }
+
+    // Arrivals, device completions and wakeups up to t, in time order
+    // (arrivals first on a tie)
+    void settle(int t, ArrivalCursor& arrivals) override {
+        for (;;) {
+            int a = arrivals.nextTime();
+            int d = nextTime();
+            if (std::min(a, d) > t) return;
+            if (a <= d) {
+                arrivals.admit(a, [&](int i) { moveOn(i, a); });
+            } else {
+                int dev = done.top().second;
+                done.pop();
+                if (dev < 0) wake(-1 - dev, d);
+                else finishIo(dev, d);
+            }
+        }
+    }
+
+    void burstDone(int i, int t) override { moveOn(i, t); }
+
+private:
+    // Process i is free at t: starts its next burst or completes
+    void moveOn(int i, int t) {
+        int last = in.first[i + 1];
+        while (next[i] < last && in.length[next[i]] <= 0) next[i]++;
+        if (next[i] == last) {
+            complete(i, t);
+            return;
+        }
+        int k = next[i]++;
+        if (in.device[k] == BurstInput::CPU) {
+            proc[i].burst = proc[i].remaining = in.length[k];
+            ready.push_back({ i, t });
+            return;
+        }
+        blockedSince[i] = t;
+        if (in.device[k] == BurstInput::SLEEP) {
+            done.push({ t + in.length[k], -1 - i });
+            return;
+        }
+        Device& dev = device[in.device[k]];
+        if (dev.serving == -1) serve(in.device[k], i, t);
+        else dev.queue.push_back(i);
+    }
+
+    void serve(int d, int i, int t) {
+        int end = t + in.length[next[i] - 1];
+        device[d].serving = i;
+        device[d].busy += end - t;
+        done.push({ end, d });
+        deviceSegments.insert(deviceSegments.end(), { d, t, end, proc[i].pid });
+    }
+
+    void finishIo(int d, int t) {
+        Device& dev = device[d];
+        int i = dev.serving;
+        dev.serving = -1;
+        if (!dev.queue.empty()) {
+            int waiting = dev.queue.front();
+            dev.queue.pop_front();
+            serve(d, waiting, t);
+        }
+        wake(i, t);
+    }
+
+    void wake(int i, int t) {
+        blocked[i] += t - blockedSince[i];
+        moveOn(i, t);
+    }
+
+    void complete(int i, int t) {
+        Process& p = proc[i];
+        p.burst = cpuTotal[i];
+        p.end = t;
+        p.turnaround = t - p.arrival;
+        p.waiting = p.turnaround - cpuTotal[i] - blocked[i];
+        if (p.start == -1) p.start = t;
+        sched.totalTurnaround += p.turnaround;
+        sched.totalWaiting += p.waiting;
+        sched.completed.push_back(p.pid);
+        sched.makespan = std::max(sched.makespan, t);
+        sched.tally.complete(p);
+        completed++;
+    }
+
+    using Event = std::pair<int, int>;   // {time, device}, device -1 - i for process i sleeping
+
+    const BurstInput& in;
+    std::vector<Process> proc;
+    std::vector<int> next;               // next burst of each process
+    std::vector<int> cpuTotal, blocked, blockedSince;
+    std::vector<Device> device;
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> done;   // device completions and wakeups
+    std::vector<int32_t> deviceSegments;
+    std::unique_ptr<Policy> policy;
+    Schedule sched;
+};
+
+IoResult IoSimulation::run(const SwitchCost& cost) {
+    int n = proc.size();
+    ArrivalCursor arrivals(proc);
+    LoopState state;
+    state.blocked = this;
+    simulate(proc, *policy, sched, arrivals, state, nullptr, cost);
+
+    IoResult r;
+    BinaryResult flat(proc, sched);
+    r.processTable = std::move(flat.processTable);
+    r.segments = std::move(flat.segments);
+    r.rounds = std::move(flat.rounds);
+    r.roundPids = std::move(flat.roundPids);
+    r.completed = std::move(flat.completed);
+    r.averageTurnaround = flat.averageTurnaround;
+    r.averageWaiting = flat.averageWaiting;
+    r.metrics = flat.metrics;
+    r.deviceSegments = std::move(deviceSegments);
+    r.makespan = sched.makespan;
+
+    int from = n ? *std::min_element(in.arrival.begin(), in.arrival.end()) : 0;
+    double span = std::max(1, r.makespan - from);
+    for (const auto& d : device) r.deviceUtilization.push_back(d.busy / span);
+    return r;
+}
+
+IoResult io_schedule(const BurstInput& input, const std::string& policy, int quantum, const SwitchCost& cost) {
+    IoSimulation sim(input, policy, quantum);
+    return sim.run(cost);
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Scheduler.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+// CPU/I-O mode: a process is a sequence of bursts, each either CPU time or
+// a request to one of the I/O devices. Finishing a burst moves the process
+// on to its next one: back to the ready queue for CPU, or blocked on the
+// device, which serves its requests one at a time in FIFO order. The run
+// is simulate()'s loop with the blocked processes as a BlockedSet, so it
+// jumps between arrivals, device completions and CPU events (its cost grows
+// with the number of bursts, not with the time span), honours a SwitchCost
+// and fast-forwards Round Robin rounds like any other run.
+
+// Input columns allocated inside the module, filled through views like
+// ProcessInput. Process i owns bursts [first[i], first[i + 1]); device[k]
+// is CPU for a CPU burst, SLEEP for a wait that needs no device (a timer,
+// a sleep seen in a trace), otherwise the device index of an I/O burst.
+struct BurstInput {
+    static constexpr int CPU = -1, SLEEP = -2;
+
+    std::vector<int> arrival, priority, first;
+    std::vector<int> length, device;
+
+    BurstInput(int n, int bursts) : arrival(n), priority(n), first(n + 1), length(bursts), device(bursts) {}
+
+    int size() const { return static_cast<int>(arrival.size()); }
+};
+
+// Flat Int32 form of a CPU/I-O run, laid out like BinaryResult. In the
+// process table, burst is the total CPU time and waiting the time spent in
+// the ready queue (blocked time excluded).
+struct IoResult {
+    static constexpr int PROCESS_FIELDS = BinaryResult::PROCESS_FIELDS;
+    static constexpr int SEGMENT_FIELDS = BinaryResult::SEGMENT_FIELDS;
+    static constexpr int ROUND_FIELDS = BinaryResult::ROUND_FIELDS;
+    static constexpr int DEVICE_SEGMENT_FIELDS = 4;   // device, start, end, pid
+
+    std::vector<int32_t> processTable;
+    std::vector<int32_t> segments;                     // CPU, skipping the Round Robin rounds
+    std::vector<int32_t> rounds, roundPids;            // as in BinaryResult
+    std::vector<int32_t> deviceSegments;               // in start order
+    std::vector<int32_t> completed;
+    std::vector<double> deviceUtilization;             // busy share of [first arrival, makespan)
+    double averageTurnaround = 0, averageWaiting = 0;
+    int makespan = 0;
+    Metrics metrics;                                   // CPU utilization, switches, percentiles
+};
+
+// Runs the bursts under a single-CPU policy by name (fcfs, rr, sjf,
+// sjf-preemptive, priority, priority-preemptive). SJF ranks by the length
+// of the current CPU burst. Throws std::invalid_argument on malformed
+// offsets, an unknown device code or an unknown policy. With a SwitchCost,
+// every switch on the CPU is charged as in switch_cost_schedule.
+IoResult io_schedule(const BurstInput& input, const std::string& policy, int quantum, const SwitchCost& cost = {});
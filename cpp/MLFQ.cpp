@@ -0,0 +1,123 @@
+#include "Scheduler.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+
+// Multi-level feedback queue: level 0 is served first, each level is FIFO
+// with its own quantum. A process that uses up its quantum drops a level;
+// one cut short by an arrival keeps its level, its place at the front and
+// the rest of its quantum. Every boostInterval ticks all waiting processes
+// go back to level 0. A bitmap of non-empty levels makes the pick O(1).
+class Mlfq final : public Specialized<Mlfq> {
+public:
+    static constexpr int MAX_LEVELS = 64;
+
+    Mlfq(const std::vector<Process>& proc, std::vector<int> quanta, int boostInterval)
+        : proc(proc), quanta(std::move(quanta)), boostInterval(boostInterval),
+          level(proc.size(), 0), used(proc.size(), 0), rings(this->quanta.size()) {
+        nextBoost = boostInterval > 0 ? boostInterval : INT_MAX;
+    }
+
+    bool empty() const override { return nonEmpty == 0; }
+
+    void push(int i) override {
+        if (i != running) {
+            level[i] = 0;
+            used[i] = 0;
+            enqueue(i, false);
+            return;
+        }
+        // Back from the CPU
+        running = -1;
+        used[i] += ranFrom - proc[i].remaining;
+        if (used[i] < quanta[level[i]]) {
+            enqueue(i, true);
+            return;
+        }
+        used[i] = 0;
+        level[i] = std::min(level[i] + 1, static_cast<int>(quanta.size()) - 1);
+        enqueue(i, false);
+    }
+
+    int pop() override {
+        int l = __builtin_ctzll(nonEmpty);
+        int i = rings[l].pop_front();
+        if (rings[l].empty()) nonEmpty &= ~(uint64_t(1) << l);
+        running = i;
+        ranFrom = proc[i].remaining;
+        return i;
+    }
+
+    void advance(int t) override {
+        if (t < nextBoost) return;
+        nextBoost = (t / boostInterval + 1) * boostInterval;
+        // Levels are drained top-down, so FIFO order within a level holds
+        IndexRing top;
+        for (auto& ring : rings) {
+            ring.forEach([&](int i) {
+                top.push_back(i);
+                level[i] = 0;
+                used[i] = 0;
+            });
+            ring.clear();
+        }
+        rings[0] = std::move(top);
+        nonEmpty = rings[0].empty() ? 0 : 1;
+    }
+
+    void finished(int i) override {
+        if (i == running) running = -1;
+    }
+
+    bool preemptive() const override { return true; }
+    int slice() const override { return running == -1 ? quanta[0] : quanta[level[running]] - used[running]; }
+    ReadyOrder readyOrder() const override { return ReadyOrder::ByPid; }
+
+    std::vector<int> queued() const override {
+        std::vector<int> out;
+        for (const auto& ring : rings) ring.forEach([&](int i) { out.push_back(i); });
+        return out;
+    }
+
+private:
+    void enqueue(int i, bool front) {
+        if (front) rings[level[i]].push_front(i);
+        else rings[level[i]].push_back(i);
+        nonEmpty |= uint64_t(1) << level[i];
+    }
+
+    const std::vector<Process>& proc;
+    std::vector<int> quanta;          // per level, at least 1
+    int boostInterval;                // 0: never
+    int nextBoost;
+    std::vector<int> level;           // per process
+    std::vector<int> used;            // ticks of the current quantum spent
+    std::vector<IndexRing> rings;     // per level
+    uint64_t nonEmpty = 0;            // bit l set when rings[l] has processes
+    int running = -1, ranFrom = 0;    // last pick and its remaining time then
+};
+
+// Quanta below 1 become 1; no levels means the default 2, 4, 8
+static std::vector<int> mlfq_levels(const std::vector<int>& quanta) {
+    std::vector<int> levels = quanta.empty() ? std::vector<int>{ 2, 4, 8 } : quanta;
+    if (levels.size() > Mlfq::MAX_LEVELS) levels.resize(Mlfq::MAX_LEVELS);
+    for (int& q : levels) q = std::max(1, q);
+    return levels;
+}
+
+static auto make_mlfq(const std::vector<int>& quanta, int boostInterval) {
+    return [levels = mlfq_levels(quanta), boostInterval](const std::vector<Process>& proc) {
+        return std::make_unique<Mlfq>(proc, levels, boostInterval);
+    };
+}
+
+std::string mlfq_schedule(const std::vector<int>& arrival, const std::vector<int>& burst,
+                          const std::vector<int>& quanta, int boostInterval) {
+    return run_policy<std::string>(process_table(columns(arrival, burst)), make_mlfq(quanta, boostInterval));
+}
+
+BinaryResult mlfq_schedule_binary(const std::vector<int>& arrival, const std::vector<int>& burst,
+                                  const std::vector<int>& quanta, int boostInterval) {
+    return run_policy<BinaryResult>(process_table(columns(arrival, burst)), make_mlfq(quanta, boostInterval));
+}
@@ -0,0 +1,47 @@
+// MLFQ levels, quanta and boosts on small hand-worked schedules
+
+#include "Tests.h"
+#include "Scheduler.h"
+#include <vector>
+
+// start, end per process in table order
+static std::vector<int> startEnd(const BinaryResult& r) {
+    std::vector<int> out;
+    for (size_t i = 0; i + BinaryResult::PROCESS_FIELDS <= r.processTable.size(); i += BinaryResult::PROCESS_FIELDS)
+        out.insert(out.end(), { r.processTable[i + 4], r.processTable[i + 5] });
+    return out;
+}
+
+// A full quantum drops a level; the bottom level keeps its quantum
+static TestCase levels("mlfq levels", [] {
+    BinaryResult r = mlfq_schedule_binary({ 0, 0 }, { 10, 10 }, { 2, 4 }, 0);
+    check(r.segments == std::vector<int32_t>{ 0, 2, 1, 2, 4, 2, 4, 8, 1, 8, 12, 2, 12, 16, 1, 16, 20, 2 },
+          "mlfq drops a level per used quantum");
+    check(r.contextSwitches == 5, "mlfq levels context switches");
+});
+
+// Cut short by an arrival, a process keeps its level, its place at the
+// front and the rest of its quantum
+static TestCase cutShort("mlfq arrival cuts a quantum", [] {
+    BinaryResult r = mlfq_schedule_binary({ 0, 1 }, { 6, 1 }, { 4, 8 }, 0);
+    check(r.segments == std::vector<int32_t>{ 0, 4, 1, 4, 5, 2, 5, 7, 1 }, "mlfq finishes the cut quantum first");
+});
+
+// A boost at the first pick past the interval lifts every waiter to level 0
+// in queue order, ahead of where the lower level would have put them
+static TestCase boost("mlfq boost", [] {
+    std::vector<int> arrival = { 0, 0, 11 }, burst = { 8, 8, 3 };
+    check(startEnd(mlfq_schedule_binary(arrival, burst, { 2, 4 }, 0)) == std::vector<int>{ 0, 16, 2, 19, 11, 17 },
+          "mlfq without boost");
+    check(startEnd(mlfq_schedule_binary(arrival, burst, { 2, 4 }, 10)) == std::vector<int>{ 0, 17, 2, 19, 11, 18 },
+          "mlfq boosted at tick 11");
+});
+
+// A process that finishes part way through its quantum is let go, and the
+// next pick starts a fresh level-0 quantum
+static TestCase finishesMidSlice("mlfq finish mid-slice", [] {
+    BinaryResult r = mlfq_schedule_binary({ 0, 0, 0 }, { 1, 5, 5 }, { 3, 6 }, 0);
+    check(r.segments == std::vector<int32_t>{ 0, 1, 1, 1, 4, 2, 4, 7, 3, 7, 9, 2, 9, 11, 3 },
+          "mlfq after a finish mid-slice");
+    check(r.contextSwitches == 4, "mlfq finish mid-slice context switches");
+});
@@ -1,305 +1,255 @@
-#include <emscripten/bind.h>
+#include "Scheduler.h"
+#include "Smp.h"
 #include <vector>
-#include <algorithm>
-#include <queue>
 #include <string>
-#include <sstream>
-#include <iostream>
-#include <map>
-#include <iomanip>
+#include <algorithm>
+#include <climits>
+
+// Highest priority first (lower value), then earlier arrival, then table order
+struct HigherPriority {
+    const std::vector<Process>& proc;
+    bool operator()(int a, int b) const {
+        if (proc[a].priority != proc[b].priority) return proc[a].priority < proc[b].priority;
+        if (proc[a].arrival != proc[b].arrival) return proc[a].arrival < proc[b].arrival;
+        return a < b;
+    }
+};
 
-using namespace emscripten;
+class PriorityPolicy final : public Specialized<PriorityPolicy, HeapPolicy<HigherPriority>> {
+public:
+    using Specialized::Specialized;
+};
 
-struct Process {
-    int pid;
-    int arrival;
-    int burst;
-    int priority;
-    int start = -1;
-    int end = -1;
-    int remaining;
-    int waiting;
-    int turnaround;
+class PriorityPreemptive final : public Specialized<PriorityPreemptive, HeapPolicy<HigherPriority>> {
+public:
+    using Specialized::Specialized;
+    bool preemptive() const override { return true; }
 };
 
-// -------------------- Non-Preemptive --------------------
-std::string priority_schedule(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority) {
-    int n = arrival.size();
-    std::vector<Process> proc(n);
-    for (int i = 0; i < n; ++i) {
-        proc[i] = {i + 1, arrival[i], burst[i], priority[i]};
+// Priority with aging: a waiting process gains `step` levels (lower value)
+// for every `interval` ticks since it was last queued. Nothing is updated
+// per tick. Processes sit in one FIFO ring per base priority with the time
+// they were queued, so the front of a ring has waited longest and ranks
+// best in it; a pick compares only the fronts of the non-empty rings,
+// computing their effective priority on demand. Ties go to the longer
+// wait, then the earlier arrival, then table order. The running process
+// ranks by its base priority and keeps the CPU until a waiter's aged
+// priority is strictly better; in preemptive mode its slice ends at the
+// tick that happens.
+class AgingPriorityPolicy final : public Specialized<AgingPriorityPolicy> {
+public:
+    AgingPriorityPolicy(const std::vector<Process>& proc, bool preempt, int step, int interval)
+        : proc(proc), preempt(preempt), step(step), interval(interval), queuedAt(proc.size(), 0),
+          level(proc.size()) {
+        std::vector<int> bases;
+        for (const Process& p : proc) bases.push_back(p.priority);
+        std::sort(bases.begin(), bases.end());
+        bases.erase(std::unique(bases.begin(), bases.end()), bases.end());
+        for (size_t i = 0; i < proc.size(); ++i)
+            level[i] = std::lower_bound(bases.begin(), bases.end(), proc[i].priority) - bases.begin();
+        rings.resize(bases.size());
+        activeAt.assign(bases.size(), -1);
     }
 
-    int currentTime = 0, completedCount = 0;
-    std::vector<std::pair<int, int>> timeline;
-    std::map<int, std::vector<int>> readyQueue;
-    std::map<int, int> running;
-    std::vector<int> completedPIDs;
-    double totalTurnaround = 0, totalWaiting = 0;
-
-    std::vector<bool> done(n, false);
-
-    while (completedCount < n) {
-        // Build ready queue at current time
-        std::vector<int> rq;
-        for (int i = 0; i < n; ++i) {
-            if (!done[i] && proc[i].arrival <= currentTime) {
-                rq.push_back(proc[i].pid);
-            }
+    bool empty() const override { return size == 0; }
+
+    void push(int i) override {
+        // Back from the CPU after a preemption check: held aside, since it
+        // keeps the CPU unless pop() finds a waiter strictly better
+        if (i == running) {
+            queuedAt[i] = now + ranFrom - proc[i].remaining;
+            running = -1;
+            held = i;
+            size++;
+            return;
         }
+        queuedAt[i] = proc[i].arrival;
+        enqueue(i);
+        size++;
+    }
 
-        readyQueue[currentTime] = rq;
-
-        // Find process with highest priority
-        int idx = -1;
-        for (int i = 0; i < n; ++i) {
-            if (!done[i] && proc[i].arrival <= currentTime) {
-                if (idx == -1 || proc[i].priority < proc[idx].priority ||
-                    (proc[i].priority == proc[idx].priority && proc[i].arrival < proc[idx].arrival)) {
-                    idx = i;
-                }
+    int pop() override {
+        int best = active.empty() ? -1 : active[0];
+        for (int l : active)
+            if (ranksBefore(rings[l].front(), rings[best].front())) best = l;
+        int i;
+        if (held != -1 && (best == -1 || effective(rings[best].front()) >= proc[held].priority)) {
+            i = held;
+        } else {
+            i = rings[best].pop_front();
+            if (rings[best].empty()) {
+                // Swap-remove from the active list
+                int moved = active.back();
+                active[activeAt[best]] = moved;
+                activeAt[moved] = activeAt[best];
+                active.pop_back();
+                activeAt[best] = -1;
             }
+            if (held != -1) enqueue(held);
         }
+        held = -1;
+        size--;
+        running = i;
+        ranFrom = proc[i].remaining;
+        return i;
+    }
 
-        // If no process is ready, just move time forward
-        if (idx == -1) {
-            currentTime++;
-            continue;
-        }
-
-        proc[idx].start = currentTime;
-        proc[idx].end = currentTime + proc[idx].burst;
-        proc[idx].turnaround = proc[idx].end - proc[idx].arrival;
-        proc[idx].waiting = proc[idx].start - proc[idx].arrival;
-
-        totalTurnaround += proc[idx].turnaround;
-        totalWaiting += proc[idx].waiting;
-
-        timeline.emplace_back(currentTime, proc[idx].pid);
-
-        // Log every second during execution
-        for (int t = currentTime; t < proc[idx].end; ++t) {
-            running[t] = proc[idx].pid;
-
-            // Build ready queue during execution (excluding running process)
-            std::vector<int> rq_during;
-            for (int i = 0; i < n; ++i) {
-                if (!done[i] && proc[i].arrival <= t && i != idx) {
-                    rq_during.push_back(proc[i].pid);
-                }
-            }
-            readyQueue[t] = rq_during;
+    void advance(int t) override { now = t; }
+    bool preemptive() const override { return preempt; }
+    ReadyOrder readyOrder() const override { return ReadyOrder::ByPid; }
+
+    // Runs until the first tick at which a waiter's aged priority is
+    // strictly better than the running process's base priority. Only ring
+    // fronts need checking, since they age first.
+    int slice() const override {
+        if (!preempt || running == -1) return INT_MAX;
+        long long until = LLONG_MAX;
+        for (int l : active) {
+            int w = rings[l].front();
+            long long need = (long long)proc[w].priority - proc[running].priority;
+            long long at = need < 0 ? now + 1 : queuedAt[w] + (need / step + 1) * interval;
+            until = std::min(until, std::max<long long>(at, now + 1));
         }
-
-        currentTime = proc[idx].end;
-        done[idx] = true;
-        completedCount++;
-        completedPIDs.push_back(proc[idx].pid);
+        return static_cast<int>(std::min<long long>(INT_MAX, until - now));
     }
 
-    // Build output JSON
-    std::ostringstream oss;
-    oss << "{";
-
-    // Process table
-    oss << "\"process_table\":[";
-    for (int i = 0; i < n; ++i) {
-        const auto& p = proc[i];
-        oss << "{"
-            << "\"pid\":" << p.pid << ","
-            << "\"arrival\":" << p.arrival << ","
-            << "\"burst\":" << p.burst << ","
-            << "\"priority\":" << p.priority << ","
-            << "\"start\":" << p.start << ","
-            << "\"end\":" << p.end << ","
-            << "\"turnaround\":" << p.turnaround << ","
-            << "\"waiting\":" << p.waiting
-            << "}";
-        if (i != n - 1) oss << ",";
+    std::vector<int> queued() const override {
+        std::vector<int> out;
+        queuedInto(out);
+        return out;
     }
-    oss << "],";
-
-    // Timeline
-    oss << "\"timeline\":[";
-    for (size_t i = 0; i < timeline.size(); ++i) {
-        oss << "{"
-            << "\"time\":" << timeline[i].first << ","
-            << "\"pid\":" << timeline[i].second
-            << "}";
-        if (i != timeline.size() - 1) oss << ",";
+    void queuedInto(std::vector<int>& out) const override {
+        out.clear();
+        for (int l : active) rings[l].forEach([&](int i) { out.push_back(i); });
+        if (held != -1) out.push_back(held);
+    }
+    void clear() override {
+        for (int l : active) {
+            rings[l].clear();
+            activeAt[l] = -1;
+        }
+        active.clear();
+        size = 0;
+        running = held = -1;
     }
-    oss << "],";
 
-    // Ready queue per second
-    oss << "\"ready_queue\":{";
-    for (auto it = readyQueue.begin(); it != readyQueue.end(); ++it) {
-        oss << "\"" << it->first << "\":[";
-        for (size_t j = 0; j < it->second.size(); ++j) {
-            oss << it->second[j];
-            if (j != it->second.size() - 1) oss << ",";
+private:
+    // Queue times never decrease, but a process back from the CPU can tie
+    // with arrivals queued just before it and must go ahead of the later ones
+    void enqueue(int i) {
+        IndexRing& ring = rings[level[i]];
+        if (ring.empty()) {
+            activeAt[level[i]] = active.size();
+            active.push_back(level[i]);
         }
-        oss << "]";
-        if (std::next(it) != readyQueue.end()) oss << ",";
+        while (!ring.empty() && queuedAt[ring.back()] == queuedAt[i] && arrivesAfter(ring.back(), i))
+            later.push_back(ring.pop_back());
+        ring.push_back(i);
+        for (; !later.empty(); later.pop_back()) ring.push_back(later.back());
     }
-    oss << "},";
 
-    // Running process per second
-    oss << "\"running_process\":{";
-    for (auto it = running.begin(); it != running.end(); ++it) {
-        oss << "\"" << it->first << "\":" << it->second;
-        if (std::next(it) != running.end()) oss << ",";
+    long long effective(int i) const {
+        return proc[i].priority - (long long)step * ((now - queuedAt[i]) / interval);
     }
-    oss << "},";
 
-    // Completed PIDs
-    oss << "\"completed\":[";
-    for (size_t i = 0; i < completedPIDs.size(); ++i) {
-        oss << completedPIDs[i];
-        if (i != completedPIDs.size() - 1) oss << ",";
+    bool arrivesAfter(int a, int b) const {
+        if (proc[a].arrival != proc[b].arrival) return proc[a].arrival > proc[b].arrival;
+        return a > b;
     }
-    oss << "],";
 
-    // Averages
-    oss << std::fixed << std::setprecision(2);
-    oss << "\"average_turnaround\":" << (totalTurnaround / n) << ",";
-    oss << "\"average_waiting\":" << (totalWaiting / n);
+    bool ranksBefore(int a, int b) const {
+        if (effective(a) != effective(b)) return effective(a) < effective(b);
+        if (queuedAt[a] != queuedAt[b]) return queuedAt[a] < queuedAt[b];
+        return arrivesAfter(b, a);
+    }
 
-    oss << "}";
+    const std::vector<Process>& proc;
+    bool preempt;
+    int step, interval;
+    std::vector<int> queuedAt;
+    std::vector<int> level;                   // per process: index of its base priority
+    std::vector<IndexRing> rings;             // per base priority, queue order
+    std::vector<int> active;                  // levels with a non-empty ring
+    std::vector<int> activeAt;                // position in `active`, -1 when empty
+    std::vector<int> later;                   // scratch for push()
+    int size = 0;
+    int now = 0;
+    int running = -1, ranFrom = 0;            // last pick and its remaining time then
+    int held = -1;                            // preempted running process, not in a ring
+};
 
-    return oss.str();
+std::unique_ptr<Policy> priority_policy(const std::vector<Process>& proc, bool preemptive) {
+    if (preemptive) return std::make_unique<PriorityPreemptive>(proc);
+    return std::make_unique<PriorityPolicy>(proc);
 }
 
-// -------------------- Preemptive --------------------
-std::string priority_preemptive_schedule(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority) {
-    int n = arrival.size();
-    std::vector<Process> proc(n);
-    for (int i = 0; i < n; ++i)
-        proc[i] = {i + 1, arrival[i], burst[i], priority[i], -1, -1, burst[i]};
-
-    int t = 0, completed = 0;
-    std::vector<int> completedPIDs;
-    std::vector<std::pair<int, int>> timeline;
-    std::map<int, std::vector<int>> readyQueue;
-    std::map<int, int> running;
-    int last_pid = -1;
-    double totalTurnaround = 0, totalWaiting = 0;
-
-    while (completed < n) {
-        int idx = -1;
-        for (int i = 0; i < n; ++i) {
-            if (proc[i].arrival <= t && proc[i].remaining > 0) {
-                if (idx == -1 || proc[i].priority < proc[idx].priority ||
-                    (proc[i].priority == proc[idx].priority && proc[i].arrival < proc[idx].arrival)) {
-                    idx = i;
-                }
-            }
-        }
-
-        std::vector<int> rq;
-        for (int i = 0; i < n; ++i) {
-            if (proc[i].arrival <= t && proc[i].remaining > 0 && i != idx)
-                rq.push_back(proc[i].pid);
-        }
-        readyQueue[t] = rq;
-
-        if (idx == -1) {
-            t++;
-            continue;
-        }
-
-        if (proc[idx].start == -1)
-            proc[idx].start = t;
-
-        proc[idx].remaining--;
-        running[t] = proc[idx].pid;
+static auto make_priority(bool preemptive) {
+    return [=](const std::vector<Process>& proc) { return priority_policy(proc, preemptive); };
+}
 
-        if (proc[idx].pid != last_pid) {
-            timeline.emplace_back(t, proc[idx].pid);
-            last_pid = proc[idx].pid;
-        }
+// -------------------- Non-Preemptive --------------------
+std::string priority_schedule(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority) {
+    return run_policy<std::string>(process_table(columns(arrival, burst, priority), true), make_priority(false), true);
+}
 
-        if (proc[idx].remaining == 0) {
-            proc[idx].end = t + 1;
-            proc[idx].turnaround = proc[idx].end - proc[idx].arrival;
-            proc[idx].waiting = proc[idx].turnaround - proc[idx].burst;
+BinaryResult priority_schedule_binary(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority) {
+    return run_policy<BinaryResult>(process_table(columns(arrival, burst, priority), true), make_priority(false));
+}
 
-            totalTurnaround += proc[idx].turnaround;
-            totalWaiting += proc[idx].waiting;
+std::string priority_schedule_input(const ProcessInput& input) {
+    return run_policy<std::string>(process_table(input.columns(), true), make_priority(false), true);
+}
 
-            completed++;
-            completedPIDs.push_back(proc[idx].pid);
-        }
+BinaryResult priority_schedule_binary_input(const ProcessInput& input) {
+    return run_policy<BinaryResult>(process_table(input.columns(), true), make_priority(false));
+}
 
-        t++;
-    }
+SmpResult priority_schedule_smp(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority, const SmpConfig& config) {
+    std::vector<Process> proc = process_table(columns(arrival, burst, priority), true);
+    return simulate_smp(proc, config, [&] { return std::make_unique<PriorityPolicy>(proc); });
+}
 
-    std::ostringstream oss;
-    oss << "{";
+// -------------------- Preemptive --------------------
+std::string priority_preemptive_schedule(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority) {
+    return run_policy<std::string>(process_table(columns(arrival, burst, priority), true), make_priority(true), true);
+}
 
-    oss << "\"process_table\":[";
-    for (int i = 0; i < n; ++i) {
-        const auto& p = proc[i];
-        oss << "{"
-            << "\"pid\":" << p.pid << ","
-            << "\"arrival\":" << p.arrival << ","
-            << "\"burst\":" << p.burst << ","
-            << "\"priority\":" << p.priority << ","
-            << "\"start\":" << p.start << ","
-            << "\"end\":" << p.end << ","
-            << "\"turnaround\":" << p.turnaround << ","
-            << "\"waiting\":" << p.waiting
-            << "}";
-        if (i != n - 1) oss << ",";
-    }
-    oss << "],";
+BinaryResult priority_preemptive_schedule_binary(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority) {
+    return run_policy<BinaryResult>(process_table(columns(arrival, burst, priority), true), make_priority(true));
+}
 
-    oss << "\"timeline\":[";
-    for (size_t i = 0; i < timeline.size(); ++i) {
-        oss << "{"
-            << "\"time\":" << timeline[i].first << ","
-            << "\"pid\":" << timeline[i].second
-            << "}";
-        if (i != timeline.size() - 1) oss << ",";
-    }
-    oss << "],";
+std::string priority_preemptive_schedule_input(const ProcessInput& input) {
+    return run_policy<std::string>(process_table(input.columns(), true), make_priority(true), true);
+}
 
-    oss << "\"ready_queue\":{";
-    for (auto it = readyQueue.begin(); it != readyQueue.end(); ++it) {
-        oss << "\"" << it->first << "\":[";
-        for (size_t j = 0; j < it->second.size(); ++j) {
-            oss << it->second[j];
-            if (j != it->second.size() - 1) oss << ",";
-        }
-        oss << "]";
-        if (std::next(it) != readyQueue.end()) oss << ",";
-    }
-    oss << "},";
+BinaryResult priority_preemptive_schedule_binary_input(const ProcessInput& input) {
+    return run_policy<BinaryResult>(process_table(input.columns(), true), make_priority(true));
+}
 
-    oss << "\"running_process\":{";
-    for (auto it = running.begin(); it != running.end(); ++it) {
-        oss << "\"" << it->first << "\":" << it->second;
-        if (std::next(it) != running.end()) oss << ",";
-    }
-    oss << "},";
+SmpResult priority_preemptive_schedule_smp(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority, const SmpConfig& config) {
+    std::vector<Process> proc = process_table(columns(arrival, burst, priority), true);
+    return simulate_smp(proc, config, [&] { return std::make_unique<PriorityPreemptive>(proc); });
+}
 
-    oss << "\"completed\":[";
-    for (size_t i = 0; i < completedPIDs.size(); ++i) {
-        oss << completedPIDs[i];
-        if (i != completedPIDs.size() - 1) oss << ",";
-    }
-    oss << "],";
+// -------------------- Aging --------------------
+// A non-positive step or interval turns aging off
+static std::unique_ptr<Policy> aging_policy(const std::vector<Process>& proc, bool preemptive, int step, int interval) {
+    if (step <= 0 || interval <= 0) return priority_policy(proc, preemptive);
+    return std::make_unique<AgingPriorityPolicy>(proc, preemptive, step, interval);
+}
 
-    oss << std::fixed << std::setprecision(2);
-    oss << "\"average_turnaround\":" << (totalTurnaround / n) << ",";
-    oss << "\"average_waiting\":" << (totalWaiting / n);
-    oss << "}";
+static auto make_aging(bool preemptive, int step, int interval) {
+    return [=](const std::vector<Process>& proc) { return aging_policy(proc, preemptive, step, interval); };
+}
 
-    return oss.str();
+std::string priority_aging_schedule(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority,
+                                    bool preemptive, int step, int interval) {
+    return run_policy<std::string>(process_table(columns(arrival, burst, priority), true),
+                                   make_aging(preemptive, step, interval), true, true);
 }
 
-// -------------------- Binding --------------------
-EMSCRIPTEN_BINDINGS(priority_module) {
-    register_vector<int>("VectorInt");
-    function("priority_schedule", &priority_schedule);
-    function("priority_preemptive_schedule", &priority_preemptive_schedule);
+BinaryResult priority_aging_schedule_binary(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority,
+                                            bool preemptive, int step, int interval) {
+    return run_policy<BinaryResult>(process_table(columns(arrival, burst, priority), true),
+                                    make_aging(preemptive, step, interval));
 }
@@ -1,185 +1,53 @@
-#include <emscripten/bind.h>
+#include "Scheduler.h"
+#include "Smp.h"
 #include <vector>
 #include <string>
-#include <sstream>
-#include <iomanip>
-#include <map>
-#include <queue>
 #include <algorithm>
 
 using namespace std;
-using namespace emscripten;
 
-struct Process {
-    int pid;
-    int arrival;
-    int burst;
-    int remaining;
-    int start = -1;
-    int end = -1;
-    int turnaround = -1;
-    int waiting = -1;
-};
-
-string rr_schedule(vector<int> arrival, vector<int> burst, int quantum) {
-    int n = arrival.size();
-    vector<Process> processes(n);
-    vector<pair<int, int>> timeline;
-    map<int, vector<int>> readyQueue;
-    map<int, int> running;
-    vector<int> completed;
-    queue<int> rq;
-
-    for (int i = 0; i < n; ++i) {
-        processes[i] = { i + 1, arrival[i], burst[i], burst[i] };
-    }
-
-    int currentTime = 0;
-    int completedCount = 0;
-    double totalTurnaround = 0, totalWaiting = 0;
-    map<int, bool> inQueue;
-
-    while (completedCount < n) {
-        // Add newly arrived processes
-        for (int i = 0; i < n; ++i) {
-            if (processes[i].arrival == currentTime && !inQueue[i]) {
-                rq.push(i);
-                inQueue[i] = true;
-            }
-        }
-
-        if (!rq.empty()) {
-            int idx = rq.front();
-            rq.pop();
-            Process& p = processes[idx];
-
-            // Record ready queue AFTER popping current process
-            vector<int> currentRQ;
-            queue<int> temp = rq;
-            while (!temp.empty()) {
-                currentRQ.push_back(processes[temp.front()].pid);
-                temp.pop();
-            }
-            readyQueue[currentTime] = currentRQ;
-
-            if (p.start == -1) {
-                p.start = currentTime;
-            }
-
-            int execTime = min(quantum, p.remaining);
-
-            for (int t = 0; t < execTime; ++t) {
-                running[currentTime] = p.pid;
-                if (t == 0) {
-                    timeline.emplace_back(currentTime, p.pid);
-                }
-                currentTime++;
-
-                // Check for arrivals during execution
-                for (int i = 0; i < n; ++i) {
-                    if (processes[i].arrival == currentTime && !inQueue[i]) {
-                        rq.push(i);
-                        inQueue[i] = true;
-                    }
-                }
-            }
-
-            p.remaining -= execTime;
-
-            if (p.remaining == 0) {
-                p.end = currentTime;
-                p.turnaround = p.end - p.arrival;
-                p.waiting = p.turnaround - p.burst;
-                totalTurnaround += p.turnaround;
-                totalWaiting += p.waiting;
-                completed.push_back(p.pid);
-                completedCount++;
-            } else {
-                rq.push(idx); // requeue
-            }
-        } else {
-            // CPU idle, still log ready queue as empty
-            readyQueue[currentTime] = {};
-            currentTime++;
-        }
-    }
-
-    // Serialize output
-    ostringstream oss;
-    oss << "{";
-
-    // Process table
-    oss << "\"process_table\":[";
-    for (int i = 0; i < n; ++i) {
-        const auto& p = processes[i];
-        oss << "{"
-            << "\"pid\":" << p.pid << ","
-            << "\"arrival\":" << p.arrival << ","
-            << "\"burst\":" << p.burst << ","
-            << "\"start\":" << p.start << ","
-            << "\"end\":" << p.end << ","
-            << "\"turnaround\":" << p.turnaround << ","
-            << "\"waiting\":" << p.waiting
-            << "}";
-        if (i != n - 1) oss << ",";
+// Round robin: FIFO ready queue, each dispatch runs for at most one quantum
+// before the process goes to the back of the queue. A quantum below 1 would
+// never advance the clock, so it is treated as 1.
+class RoundRobin final : public Specialized<RoundRobin, FifoPolicy> {
+public:
+    explicit RoundRobin(int quantum) : quantum(max(1, quantum)) {}
+
+    int slice() const override { return quantum; }
+    bool setQuantum(int q) override {
+        quantum = max(1, q);
+        return true;
     }
-    oss << "],";
+    ReadyLog readyLog() const override { return ReadyLog::DispatchAndIdle; }
+    bool roundRobin() const override { return true; }
 
-    // Timeline
-    oss << "\"timeline\":[";
-    for (size_t i = 0; i < timeline.size(); ++i) {
-        oss << "{"
-            << "\"time\":" << timeline[i].first << ","
-            << "\"pid\":" << timeline[i].second
-            << "}";
-        if (i != timeline.size() - 1) oss << ",";
-    }
-    oss << "],";
+private:
+    int quantum;
+};
 
-    // Ready queue
-    oss << "\"ready_queue\":{";
-    for (auto it = readyQueue.begin(); it != readyQueue.end(); ++it) {
-        oss << "\"" << it->first << "\":[";
-        for (size_t j = 0; j < it->second.size(); ++j) {
-            oss << it->second[j];
-            if (j != it->second.size() - 1) oss << ",";
-        }
-        oss << "]";
-        auto next = it;
-        ++next;
-        if (next != readyQueue.end()) oss << ",";
-    }
-    oss << "},";
+unique_ptr<Policy> rr_policy(int quantum) { return make_unique<RoundRobin>(quantum); }
 
-    // Running process
-    oss << "\"running_process\":{";
-    for (auto it = running.begin(); it != running.end(); ++it) {
-        oss << "\"" << it->first << "\":" << it->second;
-        auto next = it;
-        ++next;
-        if (next != running.end()) oss << ",";
-    }
-    oss << "},";
+static auto make_rr(int quantum) {
+    return [=](const vector<Process>&) { return rr_policy(quantum); };
+}
 
-    // Completed
-    oss << "\"completed\":[";
-    for (size_t i = 0; i < completed.size(); ++i) {
-        oss << completed[i];
-        if (i != completed.size() - 1) oss << ",";
-    }
-    oss << "],";
+string rr_schedule(const vector<int>& arrival, const vector<int>& burst, int quantum) {
+    return run_policy<string>(process_table(columns(arrival, burst)), make_rr(quantum));
+}
 
-    // Averages
-    oss << fixed << setprecision(2);
-    oss << "\"average_turnaround\":" << (totalTurnaround / n) << ",";
-    oss << "\"average_waiting\":" << (totalWaiting / n);
+BinaryResult rr_schedule_binary(const vector<int>& arrival, const vector<int>& burst, int quantum) {
+    return run_policy<BinaryResult>(process_table(columns(arrival, burst)), make_rr(quantum));
+}
 
-    oss << "}";
+string rr_schedule_input(const ProcessInput& input, int quantum) {
+    return run_policy<string>(process_table(input.columns()), make_rr(quantum));
+}
 
-    return oss.str();
+BinaryResult rr_schedule_binary_input(const ProcessInput& input, int quantum) {
+    return run_policy<BinaryResult>(process_table(input.columns()), make_rr(quantum));
 }
 
-EMSCRIPTEN_BINDINGS(scheduling_module) {
-    register_vector<int>("VectorInt");
-    emscripten::function("rr_schedule", &rr_schedule);
+SmpResult rr_schedule_smp(const vector<int>& arrival, const vector<int>& burst, int quantum, const SmpConfig& config) {
+    vector<Process> processes = process_table(columns(arrival, burst));
+    return simulate_smp(processes, config, [=] { return make_unique<RoundRobin>(quantum); });
 }
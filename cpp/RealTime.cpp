@@ -0,0 +1,247 @@
+#include "RealTime.h"
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <numeric>
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+// EDF keys a job by its absolute deadline, Rate Monotonic by its task's
+// period; ties go to the earlier release, then the lower task
+struct EarlierKey {
+    const std::vector<Process>& proc;
+    bool operator()(int a, int b) const {
+        if (proc[a].priority != proc[b].priority) return proc[a].priority < proc[b].priority;
+        if (proc[a].arrival != proc[b].arrival) return proc[a].arrival < proc[b].arrival;
+        return a < b;
+    }
+};
+
+class DeadlinePolicy final : public Specialized<DeadlinePolicy, HeapPolicy<EarlierKey>> {
+public:
+    using Specialized::Specialized;
+    bool preemptive() const override { return true; }
+};
+
+struct TaskSet {
+    std::vector<int> phase, period, wcet, deadline;   // deadline relative to release
+    int size() const { return static_cast<int>(period.size()); }
+};
+
+static TaskSet task_set(const std::vector<int>& phase, const std::vector<int>& period,
+                        const std::vector<int>& wcet, const std::vector<int>& deadline) {
+    if (phase.size() != period.size() || wcet.size() != period.size() || deadline.size() != period.size())
+        throw std::invalid_argument("phase, period, wcet and deadline must have the same length");
+    TaskSet ts;
+    int n = period.size();
+    for (int i = 0; i < n; ++i) {
+        ts.phase.push_back(std::max(0, phase[i]));
+        ts.period.push_back(std::max(1, period[i]));
+        ts.wcet.push_back(std::max(1, wcet[i]));
+        ts.deadline.push_back(deadline[i] > 0 ? deadline[i] : ts.period.back());
+    }
+    return ts;
+}
+
+// Every job released before `limit`, in (release, task) order. That order
+// is the same in every hyperperiod, so shifted jobs keep their tie-breaks.
+struct Jobs {
+    std::vector<Process> proc;    // pid = job index + 1, priority = scheduling key
+    std::vector<int> task;
+    std::vector<int> deadline;    // absolute
+};
+
+// Number of jobs released before `limit`
+static long long job_count(const TaskSet& ts, long long limit) {
+    long long count = 0;
+    for (int k = 0; k < ts.size(); ++k)
+        if (limit > ts.phase[k]) count += (limit - ts.phase[k] + ts.period[k] - 1) / ts.period[k];
+    return count;
+}
+
+static Jobs release_jobs(const TaskSet& ts, int limit, bool edf) {
+    if (job_count(ts, limit) > REAL_TIME_MAX_JOBS)
+        throw std::invalid_argument("horizon " + std::to_string(limit) + " releases more than " +
+                                    std::to_string(REAL_TIME_MAX_JOBS) + " jobs");
+    std::vector<std::pair<int, int>> releases;   // {release, task}
+    for (int k = 0; k < ts.size(); ++k) {
+        for (long long r = ts.phase[k]; r < limit; r += ts.period[k]) releases.push_back({ int(r), k });
+    }
+    std::sort(releases.begin(), releases.end());
+
+    Jobs jobs;
+    int n = releases.size();
+    jobs.proc.resize(n);
+    jobs.task.resize(n);
+    jobs.deadline.resize(n);
+    for (int i = 0; i < n; ++i) {
+        auto [release, k] = releases[i];
+        int due = static_cast<int>(std::min<long long>(INT_MAX, (long long)release + ts.deadline[k]));
+        jobs.proc[i] = { i + 1, release, ts.wcet[k], edf ? due : ts.period[k], ts.wcet[k] };
+        jobs.task[i] = k;
+        jobs.deadline[i] = due;
+    }
+    return jobs;
+}
+
+// Unfinished jobs at time b as {task, release - b, remaining}, in job order
+static std::vector<std::array<int, 3>> backlog(const Jobs& jobs, const Schedule& sched, int b) {
+    std::vector<int> ran(jobs.proc.size(), 0);
+    for (const auto& s : sched.segments) {
+        if (s.start >= b) break;
+        ran[s.pid - 1] += std::min(s.end, b) - s.start;
+    }
+    std::vector<std::array<int, 3>> out;
+    for (size_t i = 0; i < jobs.proc.size(); ++i) {
+        const Process& p = jobs.proc[i];
+        if (p.arrival >= b) break;
+        if (p.end > b) out.push_back({ jobs.task[i], p.arrival - b, p.burst - ran[i] });
+    }
+    return out;
+}
+
+// Lateness totals, each job counted `times` times
+struct Tally {
+    double jobs = 0, misses = 0, lateness = 0, tardiness = 0;
+    double maxLateness = -1e300;
+
+    void add(int late, double times) {
+        jobs += times;
+        lateness += late * times;
+        if (late > 0) {
+            misses += times;
+            tardiness += late * times;
+        }
+        maxLateness = std::max(maxLateness, double(late));
+    }
+};
+
+static RealTimeResult real_time(const TaskSet& ts, int horizon, bool extrapolate, bool edf) {
+    RealTimeResult r;
+    int n = ts.size();
+    long long hyper = 1;
+    int maxPhase = 0, maxPeriod = 0;
+    for (int k = 0; k < n; ++k) {
+        r.utilization += double(ts.wcet[k]) / ts.period[k];
+        maxPhase = std::max(maxPhase, ts.phase[k]);
+        maxPeriod = std::max(maxPeriod, ts.period[k]);
+        if (hyper) hyper = hyper / std::gcd(hyper, (long long)ts.period[k]) * ts.period[k];
+        if (hyper > INT_MAX) hyper = 0;
+    }
+    if (n == 0) return r;
+    if (horizon <= 0) {
+        long long span = maxPhase + (hyper ? 2 * hyper : 10LL * maxPeriod);
+        long long lo = maxPhase, hi = std::min<long long>(INT_MAX, span);
+        // Largest horizon within the job budget
+        while (lo < hi) {
+            long long mid = hi - (hi - lo) / 2;
+            if (job_count(ts, mid) <= REAL_TIME_MAX_JOBS) lo = mid;
+            else hi = mid - 1;
+        }
+        horizon = static_cast<int>(std::max<long long>(1, lo));
+    }
+    if (hyper > horizon) hyper = 0;
+    r.hyperperiod = static_cast<int>(hyper);
+
+    auto simulate_jobs = [&](Jobs& jobs) {
+        DeadlinePolicy policy(jobs.proc);
+        return simulate(jobs.proc, policy);
+    };
+
+    // Looks for the first window whose backlog at both ends matches, with
+    // ever more windows simulated; a window's jobs must all have finished
+    // inside the simulated span for their lateness to be exact
+    Jobs jobs;
+    Schedule sched(ReadyOrder::ByPid, ReadyLog::EveryTick);
+    int limit = horizon, window = -1;
+    if (extrapolate && hyper) {
+        for (long long w = 2; window < 0; w *= 2) {
+            long long span = maxPhase + w * hyper;
+            if (span >= horizon || job_count(ts, span) > REAL_TIME_MAX_JOBS) break;
+            limit = static_cast<int>(span);
+            jobs = release_jobs(ts, limit, edf);
+            sched = simulate_jobs(jobs);
+
+            auto prev = backlog(jobs, sched, maxPhase);
+            for (int j = 0; j < w && window < 0; ++j) {
+                auto next = backlog(jobs, sched, maxPhase + (j + 1) * hyper);
+                if (prev == next) {
+                    int to = maxPhase + (j + 1) * hyper;
+                    bool settled = true;
+                    for (const auto& p : jobs.proc)
+                        if (p.arrival < to && p.end > limit) settled = false;
+                    if (settled) window = j;
+                }
+                prev = std::move(next);
+            }
+            // Demand above capacity never settles into a repeating backlog
+            if (r.utilization > 1) break;
+        }
+    }
+    if (window < 0) {
+        limit = horizon;
+        jobs = release_jobs(ts, limit, edf);
+        sched = simulate_jobs(jobs);
+    }
+
+    // Jobs released in the repeating window stand for every hyperperiod
+    // left before the horizon; the last, partial one keeps only the jobs
+    // released before the horizon. Output stops after that window.
+    long long from = window < 0 ? LLONG_MAX : maxPhase + window * hyper;
+    long long full = 0, rest = 0;
+    int until = limit;
+    if (window >= 0) {
+        r.repeatsFrom = static_cast<int>(from);
+        full = (horizon - from) / hyper;
+        rest = (horizon - from) % hyper;
+        until = static_cast<int>(from + hyper);
+    }
+
+    std::vector<Tally> perTask(n);
+    Tally all;
+    r.jobs.reserve(jobs.proc.size() * RealTimeResult::JOB_FIELDS);
+    for (size_t i = 0; i < jobs.proc.size(); ++i) {
+        const Process& p = jobs.proc[i];
+        if (p.arrival >= until) break;
+        int late = p.end - jobs.deadline[i];
+        r.jobs.insert(r.jobs.end(), { jobs.task[i], p.arrival, jobs.deadline[i], p.start, p.end, late });
+
+        double times = 1;
+        if (p.arrival >= from) times = full + (p.arrival - from < rest ? 1 : 0);
+        if (times == 0) continue;
+        perTask[jobs.task[i]].add(late, times);
+        all.add(late, times);
+    }
+
+    r.segments.reserve(sched.segments.size() * RealTimeResult::SEGMENT_FIELDS);
+    for (const auto& s : sched.segments) {
+        if (s.start >= until) break;
+        r.segments.insert(r.segments.end(), { s.start, std::min(s.end, until), jobs.task[s.pid - 1] });
+    }
+
+    for (const auto& t : perTask) {
+        r.tasks.insert(r.tasks.end(), { t.jobs, t.misses, t.jobs ? t.maxLateness : 0,
+                                        t.jobs ? t.lateness / t.jobs : 0, t.jobs ? t.tardiness / t.jobs : 0 });
+    }
+    r.jobCount = all.jobs;
+    r.misses = all.misses;
+    if (all.jobs) {
+        r.maxLateness = all.maxLateness;
+        r.averageLateness = all.lateness / all.jobs;
+        r.averageTardiness = all.tardiness / all.jobs;
+    }
+    r.simulatedUntil = until;
+    return r;
+}
+
+RealTimeResult edf_schedule(const std::vector<int>& phase, const std::vector<int>& period, const std::vector<int>& wcet,
+                            const std::vector<int>& deadline, int horizon, bool extrapolate) {
+    return real_time(task_set(phase, period, wcet, deadline), horizon, extrapolate, true);
+}
+
+RealTimeResult rm_schedule(const std::vector<int>& phase, const std::vector<int>& period, const std::vector<int>& wcet,
+                           const std::vector<int>& deadline, int horizon, bool extrapolate) {
+    return real_time(task_set(phase, period, wcet, deadline), horizon, extrapolate, false);
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Scheduler.h"
+#include <vector>
+#include <cstdint>
+
+// Real-time mode: periodic tasks release a job every period, each with a
+// deadline relative to its release, and the engines track how late every
+// job finishes. Sporadic tasks are given by their minimum inter-arrival time
+// as the period; releasing them as early as allowed is their worst case,
+// which is what a schedulability check needs. Jobs run on the shared
+// simulate() loop as ordinary processes; late jobs keep running to
+// completion.
+//
+// With `extrapolate`, the engine simulates hyperperiod windows (the lcm of
+// the periods, starting after the largest phase) until the set of
+// unfinished jobs at one window boundary matches the next. From there the
+// schedule repeats every hyperperiod, so the statistics for the rest of the
+// horizon are counted from that one window instead of simulated. When the
+// pattern never settles (e.g. utilization above 1), or the hyperperiod is
+// longer than the horizon, the whole horizon is simulated. A full run stops
+// releasing jobs at the horizon, so jobs just before it can finish earlier
+// than in the steady state the extrapolation counts.
+
+// Flat form of a real-time run. Jobs and segments stop at simulatedUntil
+// (the end of the repeating window when extrapolated); the statistics
+// cover every job released before the horizon.
+struct RealTimeResult {
+    static constexpr int JOB_FIELDS = 6;      // task, release, deadline, start, end, lateness
+    static constexpr int SEGMENT_FIELDS = 3;  // start, end, task
+    // jobs, deadline misses, max lateness, average lateness, average tardiness
+    static constexpr int TASK_FIELDS = 5;
+
+    std::vector<int32_t> jobs;
+    std::vector<int32_t> segments;
+    std::vector<double> tasks;                // TASK_FIELDS per task, in input order
+    double jobCount = 0, misses = 0;
+    double maxLateness = 0, averageLateness = 0, averageTardiness = 0;
+    double utilization = 0;                   // sum of wcet / period
+    int hyperperiod = 0;                      // 0 when it does not fit the horizon
+    int repeatsFrom = -1;                     // start of the repeating window, -1 if not extrapolated
+    int simulatedUntil = 0;
+};
+
+// Most jobs one simulation releases
+constexpr long long REAL_TIME_MAX_JOBS = 1 << 22;
+
+// Tasks are given column-wise, all four columns the same length (otherwise
+// std::invalid_argument). Periods and wcets are clamped to at least 1,
+// phases to at least 0; a non-positive deadline means the period. Jobs
+// released before `horizon` are counted. A non-positive horizon selects
+// largest phase + 2 hyperperiods, or + 10 of the longest period when the
+// hyperperiod does not fit in an int, shortened if needed so that it
+// releases at most REAL_TIME_MAX_JOBS jobs. A horizon that has to be
+// simulated in full and releases more than that throws
+// std::invalid_argument.
+RealTimeResult edf_schedule(const std::vector<int>& phase, const std::vector<int>& period, const std::vector<int>& wcet,
+                            const std::vector<int>& deadline, int horizon, bool extrapolate);
+RealTimeResult rm_schedule(const std::vector<int>& phase, const std::vector<int>& period, const std::vector<int>& wcet,
+                           const std::vector<int>& deadline, int horizon, bool extrapolate);
@@ -0,0 +1,91 @@
+// Rate Monotonic and EDF on small task sets, extrapolation and input checks
+
+#include "Tests.h"
+#include "RealTime.h"
+#include <climits>
+#include <stdexcept>
+#include <vector>
+
+// Tasks (period 5, wcet 2) and (period 7, wcet 4): utilization 0.97
+static const std::vector<int> PHASE = { 0, 0 }, PERIOD = { 5, 7 }, WCET = { 2, 4 }, DEADLINE = { 0, 0 };
+
+// Rate Monotonic runs the shorter period first whatever its deadline, so
+// the second task's first job ends at 8, one past its deadline; EDF fits
+// the same set with no miss
+static TestCase rateMonotonic("rm against edf", [] {
+    RealTimeResult rm = rm_schedule(PHASE, PERIOD, WCET, DEADLINE, 35, false);
+    check(rm.jobCount == 12 && rm.misses == 1 && rm.maxLateness == 1, "rm misses one deadline per hyperperiod");
+    check(std::vector<int32_t>(rm.segments.begin(), rm.segments.begin() + 12) ==
+              std::vector<int32_t>{ 0, 2, 0, 2, 5, 1, 5, 7, 0, 7, 8, 1 },
+          "rm preempts the longer period at each short-period release");
+    check(std::vector<int32_t>(rm.jobs.begin() + RealTimeResult::JOB_FIELDS, rm.jobs.begin() + 2 * RealTimeResult::JOB_FIELDS) ==
+              std::vector<int32_t>{ 1, 0, 7, 2, 8, 1 },
+          "rm late job");
+
+    RealTimeResult edf = edf_schedule(PHASE, PERIOD, WCET, DEADLINE, 35, false);
+    check(edf.misses == 0 && edf.maxLateness == -1, "edf meets every deadline below utilization 1");
+});
+
+// Priority follows the period, not the input order: swapping the tasks
+// swaps their rows and nothing else
+static TestCase periodOrder("rm ranks by period", [] {
+    RealTimeResult a = rm_schedule(PHASE, PERIOD, WCET, DEADLINE, 35, false);
+    RealTimeResult b = rm_schedule(PHASE, { 7, 5 }, { 4, 2 }, DEADLINE, 35, false);
+    int f = RealTimeResult::TASK_FIELDS;
+    check(std::vector<double>(a.tasks.begin(), a.tasks.begin() + f) == std::vector<double>(b.tasks.begin() + f, b.tasks.end()) &&
+              std::vector<double>(a.tasks.begin() + f, a.tasks.end()) == std::vector<double>(b.tasks.begin(), b.tasks.begin() + f),
+          "rm task rows follow the input order");
+    check(a.misses == b.misses && a.averageLateness == b.averageLateness, "rm totals independent of input order");
+});
+
+// Extrapolated statistics match simulating the whole horizon
+static TestCase extrapolated("rm extrapolation", [] {
+    RealTimeResult full = rm_schedule(PHASE, PERIOD, WCET, DEADLINE, 350, false);
+    RealTimeResult fast = rm_schedule(PHASE, PERIOD, WCET, DEADLINE, 350, true);
+    check(fast.repeatsFrom == 0 && fast.simulatedUntil == 35, "rm repeats from the first hyperperiod");
+    check(fast.jobCount == full.jobCount && fast.misses == full.misses && fast.misses == 10 &&
+              fast.maxLateness == full.maxLateness && fast.averageLateness == full.averageLateness &&
+              fast.averageTardiness == full.averageTardiness && fast.tasks == full.tasks,
+          "rm extrapolated statistics");
+});
+
+// A hyperperiod past INT_MAX used to make the default horizon INT_MAX and
+// run out of memory; an explicit horizon too large to simulate throws
+static TestCase horizon("real-time horizon", [] {
+    std::vector<int> phase = { 0, 0, 0 }, period = { 999983, 999979, 999961 }, wcet = { 1000, 2000, 3000 }, deadline = { 0, 0, 0 };
+    bool ok = true;
+    try {
+        RealTimeResult r = edf_schedule(phase, period, wcet, deadline, 0, true);
+        ok = r.jobCount > 0 && r.jobCount <= REAL_TIME_MAX_JOBS && r.hyperperiod == 0;
+    } catch (const std::exception&) {
+        ok = false;
+    }
+    check(ok, "edf default horizon with an overflowing hyperperiod");
+
+    bool threw = false;
+    try {
+        edf_schedule({ 0, 0 }, { 1, 2 }, { 1, 1 }, { 0, 0 }, INT_MAX, false);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    check(threw, "edf horizon over the job budget throws");
+});
+
+// Columns of different lengths used to be read past the shorter ones
+static TestCase columnLengths("real-time column lengths", [] {
+    bool threw = false;
+    try {
+        rm_schedule({ 0 }, PERIOD, WCET, DEADLINE, 35, false);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    check(threw, "rm short phase column throws");
+
+    threw = false;
+    try {
+        edf_schedule(PHASE, PERIOD, { 2 }, { 0, 0, 0 }, 35, false);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    check(threw, "edf mismatched wcet and deadline columns throw");
+});
@@ -1,297 +1,87 @@
-#include <emscripten/bind.h>
+#include "Scheduler.h"
+#include "Smp.h"
 #include <vector>
-#include <algorithm>
-#include <queue>
 #include <string>
-#include <sstream>
-#include <iostream>
-#include <map>
-#include <iomanip>
 
-using namespace emscripten;
-
-struct Process {
-    int pid;
-    int arrival;
-    int burst;
-    int start = -1;
-    int end = -1;
-    int remaining;
-    int waiting;
-    int turnaround;
-};
-
-
-std::string sjf_schedule(const std::vector<int>& arrivalTimes, const std::vector<int>& burstTimes) {
-    int n = arrivalTimes.size();
-    std::vector<Process> proc(n);
-    for (int i = 0; i < n; i++) {
-        proc[i] = {i + 1, arrivalTimes[i], burstTimes[i], -1, -1, burstTimes[i]};
+// Shortest burst first, then table order
+struct ShortestBurst {
+    const std::vector<Process>& proc;
+    bool operator()(int a, int b) const {
+        if (proc[a].burst != proc[b].burst) return proc[a].burst < proc[b].burst;
+        return a < b;
     }
+};
 
-    int currentTime = 0, completed = 0;
-    std::vector<std::pair<int, int>> timeline;
-    std::map<int, std::vector<int>> readyQueue;
-    std::map<int, int> running;
-    std::vector<int> done(n, 0);
-    std::vector<int> completedPIDs;
-
-    double totalTurnaround = 0, totalWaiting = 0;
-
-    while (completed < n) {
-        std::vector<int> rq;
-        for (int i = 0; i < n; ++i) {
-            if (!done[i] && proc[i].arrival <= currentTime) {
-                rq.push_back(proc[i].pid);
-            }
-        }
-        readyQueue[currentTime] = rq;
-
-        int idx = -1, minBurst = 1e9;
-        for (int i = 0; i < n; ++i) {
-            if (!done[i] && proc[i].arrival <= currentTime && proc[i].burst < minBurst) {
-                minBurst = proc[i].burst;
-                idx = i;
-            }
-        }
-
-        if (idx == -1) {
-            currentTime++;
-            continue;
-        }
-
-        proc[idx].start = currentTime;
-        proc[idx].end = currentTime + proc[idx].burst;
-        proc[idx].turnaround = proc[idx].end - proc[idx].arrival;
-        proc[idx].waiting = proc[idx].start - proc[idx].arrival;
-
-        totalTurnaround += proc[idx].turnaround;
-        totalWaiting += proc[idx].waiting;
-
-        timeline.push_back({currentTime, proc[idx].pid});
-
-        for (int t = currentTime; t < proc[idx].end; ++t)
-            running[t] = proc[idx].pid;
-
-        currentTime = proc[idx].end;
-        done[idx] = 1;
-        completed++;
-        completedPIDs.push_back(proc[idx].pid);
-    }
-
-    // Serialize JSON
-    std::ostringstream oss;
-    oss << "{";
-
-    // process_table
-    oss << "\"process_table\":[";
-    for (int i = 0; i < n; ++i) {
-        const auto& p = proc[i];
-        oss << "{"
-            << "\"pid\":" << p.pid << ","
-            << "\"arrival\":" << p.arrival << ","
-            << "\"burst\":" << p.burst << ","
-            << "\"start\":" << p.start << ","
-            << "\"end\":" << p.end << ","
-            << "\"turnaround\":" << p.turnaround << ","
-            << "\"waiting\":" << p.waiting
-            << "}";
-        if (i != n - 1) oss << ",";
-    }
-    oss << "],";
-
-    // timeline
-    oss << "\"timeline\":[";
-    for (size_t i = 0; i < timeline.size(); ++i) {
-        oss << "{"
-            << "\"time\":" << timeline[i].first << ","
-            << "\"pid\":" << timeline[i].second
-            << "}";
-        if (i != timeline.size() - 1) oss << ",";
-    }
-    oss << "],";
-
-    // ready_queue
-    oss << "\"ready_queue\":{";
-    for (auto it = readyQueue.begin(); it != readyQueue.end(); ++it) {
-        oss << "\"" << it->first << "\":[";
-        for (size_t j = 0; j < it->second.size(); ++j) {
-            oss << it->second[j];
-            if (j != it->second.size() - 1) oss << ",";
-        }
-        oss << "]";
-        if (std::next(it) != readyQueue.end()) oss << ",";
+// Shortest remaining time first, then earlier arrival, then lower pid
+struct ShortestRemaining {
+    const std::vector<Process>& proc;
+    bool operator()(int a, int b) const {
+        if (proc[a].remaining != proc[b].remaining) return proc[a].remaining < proc[b].remaining;
+        if (proc[a].arrival != proc[b].arrival) return proc[a].arrival < proc[b].arrival;
+        return proc[a].pid < proc[b].pid;
     }
-    oss << "},";
+};
 
-    // running_process
-    oss << "\"running_process\":{";
-    for (auto it = running.begin(); it != running.end(); ++it) {
-        oss << "\"" << it->first << "\":" << it->second;
-        if (std::next(it) != running.end()) oss << ",";
-    }
-    oss << "},";
+class Sjf final : public Specialized<Sjf, HeapPolicy<ShortestBurst>> {
+public:
+    using Specialized::Specialized;
+    ReadyLog readyLog() const override { return ReadyLog::DispatchAndIdle; }
+    bool listsDispatched() const override { return true; }
+};
 
-    // completed list
-    oss << "\"completed\":[";
-    for (size_t i = 0; i < completedPIDs.size(); ++i) {
-        oss << completedPIDs[i];
-        if (i != completedPIDs.size() - 1) oss << ",";
-    }
-    oss << "],";
+class SjfPreemptive final : public Specialized<SjfPreemptive, HeapPolicy<ShortestRemaining>> {
+public:
+    using Specialized::Specialized;
+    bool preemptive() const override { return true; }
+};
 
-    // Averages
-    oss << std::fixed << std::setprecision(2);
-    oss << "\"average_turnaround\":" << (totalTurnaround / n) << ",";
-    oss << "\"average_waiting\":" << (totalWaiting / n);
+std::unique_ptr<Policy> sjf_policy(const std::vector<Process>& proc, bool preemptive) {
+    if (preemptive) return std::make_unique<SjfPreemptive>(proc);
+    return std::make_unique<Sjf>(proc);
+}
 
-    oss << "}";
-    return oss.str();
+static auto make_sjf(bool preemptive) {
+    return [=](const std::vector<Process>& proc) { return sjf_policy(proc, preemptive); };
 }
 
+std::string sjf_schedule(const std::vector<int>& arrivalTimes, const std::vector<int>& burstTimes) {
+    return run_policy<std::string>(process_table(columns(arrivalTimes, burstTimes)), make_sjf(false));
+}
 
 std::string sjf_preemptive_schedule(const std::vector<int>& arrivalTimes, const std::vector<int>& burstTimes) {
-    int n = arrivalTimes.size();
-    std::vector<Process> proc(n);
-    for (int i = 0; i < n; i++) {
-        proc[i] = {i + 1, arrivalTimes[i], burstTimes[i], -1, -1, burstTimes[i]};
-    }
-
-    int t = 0, completed = 0, shortest = -1, minm = 1e9;
-    std::vector<int> completedPIDs;
-    std::vector<std::pair<int, int>> timeline;
-    std::map<int, std::vector<int>> readyQueue;
-    std::map<int, int> running;
-    double totalTurnaround = 0, totalWaiting = 0;
-    int last_pid = -1;
-
-    while (completed < n) {
-        // Step 1: Find the shortest remaining time process at time t
-        shortest = -1;
-        minm = 1e9;
-        for (int i = 0; i < n; i++) {
-            if (proc[i].arrival <= t && proc[i].remaining > 0) {
-                if (proc[i].remaining < minm ||
-                    (proc[i].remaining == minm && proc[i].arrival < proc[shortest].arrival) ||
-                    (proc[i].remaining == minm && proc[i].arrival == proc[shortest].arrival && proc[i].pid < proc[shortest].pid)) {
-                    minm = proc[i].remaining;
-                    shortest = i;
-                }
-            }
-        }
-
-        // Step 2: Build ready queue excluding the currently running process
-        std::vector<int> rq;
-        for (int i = 0; i < n; i++) {
-            if (proc[i].arrival <= t && proc[i].remaining > 0 && i != shortest) {
-                rq.push_back(proc[i].pid);
-            }
-        }
-        readyQueue[t] = rq;
-
-        // Step 3: If no process is ready to run, idle
-        if (shortest == -1) {
-            t++;
-            continue;
-        }
-
-        // Step 4: Run the chosen process
-        if (proc[shortest].start == -1)
-            proc[shortest].start = t;
-
-        proc[shortest].remaining--;
-        running[t] = proc[shortest].pid;
-
-        if (last_pid != proc[shortest].pid) {
-            timeline.push_back({t, proc[shortest].pid});
-            last_pid = proc[shortest].pid;
-        }
-
-        // Step 5: Check for completion
-        if (proc[shortest].remaining == 0) {
-            proc[shortest].end = t + 1;
-            proc[shortest].turnaround = proc[shortest].end - proc[shortest].arrival;
-            proc[shortest].waiting = proc[shortest].turnaround - proc[shortest].burst;
-
-            totalTurnaround += proc[shortest].turnaround;
-            totalWaiting += proc[shortest].waiting;
-
-            completed++;
-            completedPIDs.push_back(proc[shortest].pid);
-        }
-
-        t++;
-    }
-
-    // Step 6: Serialize output
-    std::ostringstream oss;
-    oss << "{";
-
-    oss << "\"process_table\":[";
-    for (int i = 0; i < n; ++i) {
-        const auto& p = proc[i];
-        oss << "{"
-            << "\"pid\":" << p.pid << ","
-            << "\"arrival\":" << p.arrival << ","
-            << "\"burst\":" << p.burst << ","
-            << "\"start\":" << p.start << ","
-            << "\"end\":" << p.end << ","
-            << "\"turnaround\":" << p.turnaround << ","
-            << "\"waiting\":" << p.waiting
-            << "}";
-        if (i != n - 1) oss << ",";
-    }
-    oss << "],";
+    return run_policy<std::string>(process_table(columns(arrivalTimes, burstTimes)), make_sjf(true));
+}
 
-    oss << "\"timeline\":[";
-    for (size_t i = 0; i < timeline.size(); ++i) {
-        oss << "{"
-            << "\"time\":" << timeline[i].first << ","
-            << "\"pid\":" << timeline[i].second
-            << "}";
-        if (i != timeline.size() - 1) oss << ",";
-    }
-    oss << "],";
+BinaryResult sjf_schedule_binary(const std::vector<int>& arrivalTimes, const std::vector<int>& burstTimes) {
+    return run_policy<BinaryResult>(process_table(columns(arrivalTimes, burstTimes)), make_sjf(false));
+}
 
-    oss << "\"ready_queue\":{";
-    for (auto it = readyQueue.begin(); it != readyQueue.end(); ++it) {
-        oss << "\"" << it->first << "\":[";
-        for (size_t j = 0; j < it->second.size(); ++j) {
-            oss << it->second[j];
-            if (j != it->second.size() - 1) oss << ",";
-        }
-        oss << "]";
-        if (std::next(it) != readyQueue.end()) oss << ",";
-    }
-    oss << "},";
+BinaryResult sjf_preemptive_schedule_binary(const std::vector<int>& arrivalTimes, const std::vector<int>& burstTimes) {
+    return run_policy<BinaryResult>(process_table(columns(arrivalTimes, burstTimes)), make_sjf(true));
+}
 
-    oss << "\"running_process\":{";
-    for (auto it = running.begin(); it != running.end(); ++it) {
-        oss << "\"" << it->first << "\":" << it->second;
-        if (std::next(it) != running.end()) oss << ",";
-    }
-    oss << "},";
+std::string sjf_schedule_input(const ProcessInput& input) {
+    return run_policy<std::string>(process_table(input.columns()), make_sjf(false));
+}
 
-    oss << "\"completed\":[";
-    for (size_t i = 0; i < completedPIDs.size(); ++i) {
-        oss << completedPIDs[i];
-        if (i != completedPIDs.size() - 1) oss << ",";
-    }
-    oss << "],";
+std::string sjf_preemptive_schedule_input(const ProcessInput& input) {
+    return run_policy<std::string>(process_table(input.columns()), make_sjf(true));
+}
 
-    oss << std::fixed << std::setprecision(2);
-    oss << "\"average_turnaround\":" << (totalTurnaround / n) << ",";
-    oss << "\"average_waiting\":" << (totalWaiting / n);
-    oss << "}";
+BinaryResult sjf_schedule_binary_input(const ProcessInput& input) {
+    return run_policy<BinaryResult>(process_table(input.columns()), make_sjf(false));
+}
 
-    return oss.str();
+BinaryResult sjf_preemptive_schedule_binary_input(const ProcessInput& input) {
+    return run_policy<BinaryResult>(process_table(input.columns()), make_sjf(true));
 }
 
+SmpResult sjf_schedule_smp(const std::vector<int>& arrivalTimes, const std::vector<int>& burstTimes, const SmpConfig& config) {
+    std::vector<Process> proc = process_table(columns(arrivalTimes, burstTimes));
+    return simulate_smp(proc, config, [&] { return std::make_unique<Sjf>(proc); });
+}
 
-// Bind functions to JS
-EMSCRIPTEN_BINDINGS(sjf_module) {
-    emscripten::register_vector<int>("VectorInt");
-    emscripten::function("sjf_schedule", &sjf_schedule);
-    emscripten::function("sjf_preemptive_schedule", &sjf_preemptive_schedule);
-    
+SmpResult sjf_preemptive_schedule_smp(const std::vector<int>& arrivalTimes, const std::vector<int>& burstTimes, const SmpConfig& config) {
+    std::vector<Process> proc = process_table(columns(arrivalTimes, burstTimes));
+    return simulate_smp(proc, config, [&] { return std::make_unique<SjfPreemptive>(proc); });
 }
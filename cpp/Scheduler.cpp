@@ -0,0 +1,182 @@
+#include "Scheduler.h"
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <stdexcept>
+
+Schedule simulate(std::vector<Process>& proc, Policy& policy, const SwitchCost& cost) {
+    Schedule sched(policy.readyOrder(), policy.readyLog(), policy.listsDispatched());
+    ArrivalCursor arrivals(proc);
+    LoopState state;
+    simulate(proc, policy, sched, arrivals, state, nullptr, cost);
+    return sched;
+}
+
+// Round Robin with m processes queued and no arrival due: every process
+// keeps taking a full quantum in the same order until one of them is about
+// to finish or the next event (arrival or wakeup, at nextEvent) lands. Runs k
+// such rounds at once, where k is the largest count that leaves every process
+// unfinished and ends before that event; the queue is back in the same order
+// afterwards.
+bool skip_rounds(std::vector<Process>& proc, const Policy& policy, Schedule& sched,
+                 int nextEvent, LoopState& state) {
+    // Kept across calls so that repeated runs do not allocate
+    thread_local std::vector<int> ready, pids;
+    policy.queuedInto(ready);
+    long long m = ready.size(), q = policy.slice();
+    state.roundCheck = m;   // O(m) work, so at most once every m picks
+
+    long long round = m * q;
+    long long k = (INT_MAX - state.t) / round;
+    for (int i : ready) k = std::min<long long>(k, (proc[i].remaining - 1) / q);
+    if (nextEvent != INT_MAX)
+        k = std::min<long long>(k, (nextEvent - 1 - state.t) / round);
+    if (k < 2) return false;
+
+    pids.resize(m);
+    for (int j = 0; j < m; ++j) {
+        Process& p = proc[ready[j]];
+        if (p.start == -1) p.start = state.t + j * q;
+        p.remaining -= k * q;
+        pids[j] = p.pid;
+    }
+    sched.repeat(state.t, q, k, pids);
+    state.t += k * round;
+    state.last_pid = pids.back();
+    state.preempted = false;
+    return true;
+}
+
+void simulate(std::vector<Process>& proc, Policy& policy, Schedule& sched,
+              ArrivalCursor& arrivals, LoopState& state, Checkpoints* saves, const SwitchCost& cost,
+              const RunLimit& limit) {
+    policy.run(proc, sched, arrivals, state, saves, cost, limit);
+}
+
+std::unique_ptr<Policy> policy_by_name(const std::string& name, const std::vector<Process>& proc, int quantum) {
+    if (name == "fcfs") return fcfs_policy();
+    if (name == "rr") return rr_policy(quantum);
+    if (name == "sjf") return sjf_policy(proc, false);
+    if (name == "sjf-preemptive") return sjf_policy(proc, true);
+    if (name == "priority") return priority_policy(proc, false);
+    if (name == "priority-preemptive") return priority_policy(proc, true);
+    throw std::invalid_argument("unknown policy " + name);
+}
+
+static bool uses_priority(const std::string& policy) {
+    return policy == "priority" || policy == "priority-preemptive";
+}
+
+std::vector<Process> process_table(const ProcessColumns& in, bool withPriority) {
+    std::vector<Process> proc(in.n);
+    for (int i = 0; i < in.n; ++i)
+        proc[i] = { i + 1, in.arrival[i], in.burst[i], withPriority ? in.priority[i] : 0, in.burst[i] };
+    return proc;
+}
+
+// Table for switch_cost_schedule, built like the policy's own entry point:
+// priorities only where the policy reads them, and FCFS listed by arrival
+static std::vector<Process> switch_cost_processes(const ProcessInput& input, const std::string& policy) {
+    std::vector<Process> proc = process_table(input.columns(), uses_priority(policy));
+    if (policy == "fcfs") sort_by_arrival(proc);
+    return proc;
+}
+
+std::string switch_cost_schedule(const ProcessInput& input, const std::string& policy, int quantum, const SwitchCost& cost) {
+    std::vector<Process> proc = switch_cost_processes(input, policy);
+    std::unique_ptr<Policy> p = policy_by_name(policy, proc, quantum);
+    Schedule sched = simulate(proc, *p, cost);
+    return to_json(proc, sched, uses_priority(policy));
+}
+
+BinaryResult switch_cost_schedule_binary(const ProcessInput& input, const std::string& policy, int quantum, const SwitchCost& cost) {
+    std::vector<Process> proc = switch_cost_processes(input, policy);
+    std::unique_ptr<Policy> p = policy_by_name(policy, proc, quantum);
+    Schedule sched = simulate(proc, *p, cost);
+    return BinaryResult(proc, sched);
+}
+
+void write_metrics(std::ostream& os, const Metrics& m) {
+    auto percentiles = [&](const char* name, const Percentiles& p) {
+        os << ",\"" << name << "\":{\"p50\":" << p.p50 << ",\"p95\":" << p.p95
+           << ",\"p99\":" << p.p99 << ",\"max\":" << p.max << "}";
+    };
+    os << std::fixed << std::setprecision(2);
+    os << "{\"average_response\":" << m.averageResponse
+       << ",\"throughput\":" << std::setprecision(4) << m.throughput << std::setprecision(2)
+       << ",\"cpu_utilization\":" << m.cpuUtilization
+       << ",\"idle\":" << m.idle
+       << ",\"switch_overhead\":" << m.switchOverhead
+       << ",\"context_switches\":" << m.contextSwitches;
+    percentiles("waiting", m.waiting);
+    percentiles("turnaround", m.turnaround);
+    percentiles("response", m.response);
+    os << "}";
+}
+
+std::string to_json(const std::vector<Process>& proc, const Schedule& sched, bool withPriority, bool withWait) {
+    if (!sched.rounds.empty()) return to_json(proc, sched.expanded(), withPriority, withWait);
+
+    int n = proc.size();
+    std::ostringstream oss;
+    oss << "{";
+
+    // Process table
+    oss << "\"process_table\":[";
+    for (int i = 0; i < n; ++i) {
+        const auto& p = proc[i];
+        oss << "{"
+            << "\"pid\":" << p.pid << ","
+            << "\"arrival\":" << p.arrival << ","
+            << "\"burst\":" << p.burst << ",";
+        if (withPriority)
+            oss << "\"priority\":" << p.priority << ",";
+        oss << "\"start\":" << p.start << ","
+            << "\"end\":" << p.end << ","
+            << "\"turnaround\":" << p.turnaround << ","
+            << "\"waiting\":" << p.waiting
+            << "}";
+        if (i != n - 1) oss << ",";
+    }
+    oss << "],";
+
+    // Timeline
+    oss << "\"timeline\":[";
+    for (size_t i = 0; i < sched.timeline.size(); ++i) {
+        oss << "{"
+            << "\"time\":" << sched.timeline[i].first << ","
+            << "\"pid\":" << sched.timeline[i].second
+            << "}";
+        if (i != sched.timeline.size() - 1) oss << ",";
+    }
+    oss << "],";
+
+    // Ready queue
+    oss << "\"ready_queue\":{";
+    sched.writeReadyQueue(oss);
+    oss << "},";
+
+    // Running process
+    oss << "\"running_process\":{";
+    sched.writeRunning(oss);
+    oss << "},";
+
+    // Completed list
+    oss << "\"completed\":[";
+    for (size_t i = 0; i < sched.completed.size(); ++i) {
+        oss << sched.completed[i];
+        if (i != sched.completed.size() - 1) oss << ",";
+    }
+    oss << "],";
+
+    // Averages
+    oss << std::fixed << std::setprecision(2);
+    oss << "\"average_turnaround\":" << (sched.totalTurnaround / n) << ",";
+    oss << "\"average_waiting\":" << (sched.totalWaiting / n);
+    if (withWait) oss << ",\"max_wait\":" << sched.maxWait();
+    write_metrics(oss << ",\"metrics\":", sched.metrics(proc));
+
+    oss << "}";
+
+    return oss.str();
+}
@@ -0,0 +1,412 @@
+#pragma once
+
+#include "Simulation.h"
+#include <vector>
+#include <string>
+#include <ostream>
+#include <climits>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+struct LoopState;
+struct RunLimit;
+class Checkpoints;
+
+// A scheduling policy: its ready queue plus the rules the shared loop needs
+// to drive it. Everything else (arrivals, clock, recording) lives in
+// simulate(), so a new policy only has to say how it picks. Concrete
+// policies derive through Specialized (below), which gives each one its own
+// copy of the loop.
+class Policy {
+public:
+    virtual ~Policy() = default;
+
+    virtual bool empty() const = 0;
+    virtual void push(int i) = 0;
+    virtual int pop() = 0;
+
+    // Re-evaluate the pick whenever a new process arrives
+    virtual bool preemptive() const { return false; }
+
+    // Called with the clock before every pick, for policies whose queue
+    // changes with time alone (e.g. periodic priority boosts)
+    virtual void advance(int /*t*/) {}
+
+    // Longest stretch the process just popped runs before going back to the
+    // queue
+    virtual int slice() const { return INT_MAX; }
+
+    // The process just popped left the CPU for good (or for I/O) instead of
+    // going back to the queue; policies that track it let go of it here
+    virtual void finished(int /*i*/) {}
+
+    // Retunes a policy with a fixed slice (Round Robin) to a new quantum;
+    // false for policies that take none
+    virtual bool setQuantum(int /*quantum*/) { return false; }
+
+    // How the legacy ready_queue output lists and samples this queue
+    virtual ReadyOrder readyOrder() const = 0;
+    virtual ReadyLog readyLog() const { return ReadyLog::EveryTick; }
+    virtual bool listsDispatched() const { return false; }
+
+    // Copy of the policy with its queue, for checkpoints
+    virtual std::unique_ptr<Policy> clone() const = 0;
+
+    // The loop of simulate() compiled for this policy's own type
+    virtual void run(std::vector<Process>& proc, Schedule& sched, ArrivalCursor& arrivals, LoopState& state,
+                     Checkpoints* saves, const SwitchCost& cost, const RunLimit& limit) = 0;
+
+    // Indices currently queued, in no particular order
+    virtual std::vector<int> queued() const = 0;
+
+    // queued() into `out`, reusing its storage
+    virtual void queuedInto(std::vector<int>& out) const { out = queued(); }
+
+    // Empties the queue for a new run over the same process table. Queues
+    // that can drop everything at once override it and keep their storage.
+    virtual void clear() {
+        while (!empty()) pop();
+    }
+
+    // A FIFO queue rotated by a fixed slice(), with queued() in queue order;
+    // lets simulate() skip whole rounds in closed form
+    virtual bool roundRobin() const { return false; }
+};
+
+// Ready queue served in arrival order
+class FifoPolicy : public Policy {
+public:
+    bool empty() const override { return queue.empty(); }
+    void push(int i) override { queue.push_back(i); }
+    int pop() override { return queue.pop_front(); }
+    ReadyOrder readyOrder() const override { return ReadyOrder::Fifo; }
+    std::vector<int> queued() const override {
+        std::vector<int> out;
+        queuedInto(out);
+        return out;
+    }
+    void queuedInto(std::vector<int>& out) const override {
+        out.clear();
+        queue.forEach([&](int i) { out.push_back(i); });
+    }
+    void clear() override { queue.clear(); }
+
+private:
+    IndexRing queue;
+};
+
+// Ready queue ordered by a comparator over the process table
+template <typename Better>
+class HeapPolicy : public Policy {
+public:
+    explicit HeapPolicy(const std::vector<Process>& proc) : heap(Better{ proc }) {}
+
+    bool empty() const override { return heap.empty(); }
+    void push(int i) override { heap.push(i); }
+    int pop() override { return heap.pop(); }
+    ReadyOrder readyOrder() const override { return ReadyOrder::ByPid; }
+    std::vector<int> queued() const override { return heap.items(); }
+    void queuedInto(std::vector<int>& out) const override { out.assign(heap.items().begin(), heap.items().end()); }
+    void clear() override { heap.clear(); }
+
+private:
+    ReadyHeap<Better> heap;
+};
+
+// Loop variables of simulate() between iterations
+// Processes between two CPU bursts, for runs where a process is a sequence
+// of bursts (see Io.h). With one on LoopState, simulate_loop() hands it the
+// arrivals and every finished CPU burst instead of queuing and completing
+// processes itself, and queues what it hands back in `ready`: each process
+// whose next CPU burst is ready, with the time it became ready. It also
+// counts the completions, which the loop then takes as its own.
+class BlockedSet {
+public:
+    virtual ~BlockedSet() = default;
+
+    // Earliest wakeup of a blocked process, INT_MAX if none is blocked
+    virtual int nextTime() const = 0;
+    // Arrivals and wakeups up to t, in time order (arrivals first on a tie)
+    virtual void settle(int t, ArrivalCursor& arrivals) = 0;
+    // Process i finished its current CPU burst at t
+    virtual void burstDone(int i, int t) = 0;
+
+    std::vector<std::pair<int, int>> ready;   // {index, time}, drained by the loop
+    int completed = 0;
+};
+
+struct LoopState {
+    int t = 0;
+    int completed = 0;
+    int last_pid = -1;
+    bool preempted = false;   // last run was cut short by an arrival
+    int roundCheck = 0;       // picks left before the next fast-forward attempt
+    std::vector<int> lastRan; // end of each process's last run; only kept with a SwitchCost
+    BlockedSet* blocked = nullptr;   // CPU/I-O runs only; kept by reset()
+
+    // Back to the start of a run; lastRan keeps its storage
+    void reset() {
+        t = 0;
+        completed = 0;
+        last_pid = -1;
+        preempted = false;
+        roundCheck = 0;
+        lastRan.clear();
+    }
+};
+
+// Where a resumable simulate() call stops early, with `state` ready for the
+// next call: after `events` loop iterations, or once *cancel is set
+struct RunLimit {
+    long long events = LLONG_MAX;
+    const std::atomic<bool>* cancel = nullptr;
+};
+
+// Runs `policy` over the process table, filling start/end/turnaround/waiting.
+// With a SwitchCost, every dispatch of a different process than the last one
+// first spends the switch on the CPU (see Schedule::overhead); a process
+// starts, and its slice begins, once the switch is done.
+Schedule simulate(std::vector<Process>& proc, Policy& policy, const SwitchCost& cost = {});
+
+// Carries on a run from `state`, recording into `sched`; with `saves`,
+// checkpoints are taken along the way (see Incremental.h). The run is over
+// once state.completed reaches the table size.
+void simulate(std::vector<Process>& proc, Policy& policy, Schedule& sched,
+              ArrivalCursor& arrivals, LoopState& state, Checkpoints* saves, const SwitchCost& cost = {},
+              const RunLimit& limit = {});
+
+// Helpers of simulate_loop() that stay out of line: Checkpoints::save (see
+// Incremental.h), and the Round Robin fast-forward, tried once every few
+// picks at most
+void save_checkpoint(Checkpoints& saves, const std::vector<Process>& proc, const Policy& policy,
+                     const Schedule& sched, const ArrivalCursor& arrivals, const LoopState& state);
+bool skip_rounds(std::vector<Process>& proc, const Policy& policy, Schedule& sched,
+                 int nextEvent, LoopState& state);
+
+// The body of simulate(), instantiated for a concrete policy type P. With P
+// final every call into the policy (push, pop, preemptive(), slice(), the
+// heap comparator) resolves at compile time and can be inlined, so each
+// policy runs a loop of its own without virtual dispatch per event.
+template <typename P>
+void simulate_loop(std::vector<Process>& proc, P& policy, Schedule& sched,
+                   ArrivalCursor& arrivals, LoopState& state, Checkpoints* saves, const SwitchCost& cost,
+                   const RunLimit& limit) {
+    int n = proc.size();
+    auto admit = [&](int i) {
+        policy.push(i);
+        sched.enter(proc[i].arrival, proc[i].pid);
+    };
+
+    // With a BlockedSet, wakeups are events like arrivals, and the set
+    // decides what a finished CPU burst leads to
+    BlockedSet* blocked = state.blocked;
+    auto nextEvent = [&] {
+        return blocked ? std::min(arrivals.nextTime(), blocked->nextTime()) : arrivals.nextTime();
+    };
+    auto takeReady = [&] {
+        for (auto [i, at] : blocked->ready) {
+            policy.push(i);
+            sched.enter(at, proc[i].pid);
+        }
+        blocked->ready.clear();
+        state.completed = blocked->completed;
+    };
+    auto settle = [&](int at) {
+        if (!blocked) {
+            arrivals.admit(at, admit);
+            return;
+        }
+        blocked->settle(at, arrivals);
+        takeReady();
+    };
+
+    int& t = state.t;
+    int& last_pid = state.last_pid;
+    bool& preempted = state.preempted;
+
+    long long events = limit.events;
+    while (state.completed < n) {
+        if (events-- <= 0 || (limit.cancel && limit.cancel->load(std::memory_order_relaxed))) return;
+        if (saves) save_checkpoint(*saves, proc, policy, sched, arrivals, state);
+        settle(t);
+
+        // Nothing ready: jump to the next arrival or wakeup
+        if (policy.empty()) {
+            t = nextEvent();
+            continue;
+        }
+
+        // Rounds with a switch between every slice are not skipped
+        if (policy.roundRobin() && !cost.enabled() && --state.roundCheck <= 0 &&
+            skip_rounds(proc, policy, sched, nextEvent(), state))
+            continue;
+
+        policy.advance(t);
+        int idx = policy.pop();
+        Process& p = proc[idx];
+        sched.leave(t, p.pid);
+
+        if (cost.enabled() && p.pid != last_pid) {
+            if (state.lastRan.empty()) state.lastRan.assign(n, -1);
+            int ran = state.lastRan[idx];
+            int switchEnd = t + cost.ticks(ran < 0 ? -1 : t - ran);
+            sched.overhead(t, switchEnd);
+            t = switchEnd;
+        }
+
+        if (p.start == -1)
+            p.start = t;
+
+        // Run until completion, end of slice, or an arrival (or wakeup) that
+        // may preempt; one that came in during the switch is weighed as soon
+        // as it is done
+        int until = t + std::min(p.remaining, policy.slice());
+        bool cut = false;
+        int next = nextEvent();
+        if (policy.preemptive() && next < until) {
+            until = std::max(t, next);
+            cut = until > t;
+        }
+
+        // Keeping the CPU through a preemption check is not a new dispatch
+        if (until > t && !(preempted && p.pid == last_pid))
+            sched.dispatch(t, p.pid);
+
+        sched.run(t, until, p.pid);
+        p.remaining -= until - t;
+        t = until;
+        last_pid = p.pid;
+        preempted = cut;
+        if (!state.lastRan.empty()) state.lastRan[idx] = t;
+
+        // Arrivals during the run queue up ahead of a process sent back
+        settle(t);
+
+        if (p.remaining == 0) {
+            policy.finished(idx);
+            if (blocked) {
+                blocked->burstDone(idx, t);
+                takeReady();
+            } else {
+                sched.complete(p, t);
+                state.completed++;
+            }
+        } else {
+            policy.push(idx);
+            sched.enter(t, p.pid);
+        }
+    }
+}
+
+// Base of every concrete policy: `class Mine final : public Specialized<Mine>`
+// (or Specialized<Mine, FifoPolicy> etc. to start from a stock queue). It
+// supplies clone() and a run() that enters simulate_loop<Mine>, so a new
+// policy gets the specialized loop by deriving from it.
+template <typename Self, typename Base = Policy>
+class Specialized : public Base {
+public:
+    using Base::Base;
+
+    std::unique_ptr<Policy> clone() const override {
+        return std::make_unique<Self>(static_cast<const Self&>(*this));
+    }
+    void run(std::vector<Process>& proc, Schedule& sched, ArrivalCursor& arrivals, LoopState& state,
+             Checkpoints* saves, const SwitchCost& cost, const RunLimit& limit) override {
+        simulate_loop(proc, static_cast<Self&>(*this), sched, arrivals, state, saves, cost, limit);
+    }
+};
+
+// {"average_response":..,"throughput":..,...,"waiting":{"p50":..},...}
+void write_metrics(std::ostream& os, const Metrics& m);
+
+// The JSON document every *_schedule entry point returns; withWait adds
+// "max_wait", the longest single stretch a process spent in the ready queue
+std::string to_json(const std::vector<Process>& proc, const Schedule& sched, bool withPriority = false,
+                    bool withWait = false);
+
+// -------------------- Policies --------------------
+// Each policy file's ready queue, for callers that drive simulate() directly
+std::unique_ptr<Policy> fcfs_policy();
+// The order FCFS lists its table in: by arrival, ties by pid. Every FCFS
+// entry point (plain, switch cost, incremental, Simulator) uses it.
+void sort_by_arrival(std::vector<Process>& proc);
+std::unique_ptr<Policy> rr_policy(int quantum);
+std::unique_ptr<Policy> sjf_policy(const std::vector<Process>& proc, bool preemptive);
+std::unique_ptr<Policy> priority_policy(const std::vector<Process>& proc, bool preemptive);
+
+// One of the above by the name the CLI takes (fcfs, rr, sjf, sjf-preemptive,
+// priority, priority-preemptive); throws std::invalid_argument otherwise
+std::unique_ptr<Policy> policy_by_name(const std::string& name, const std::vector<Process>& proc, int quantum);
+
+// -------------------- Entry points --------------------
+// Table with pid = row + 1; the priority column only for policies that read it
+std::vector<Process> process_table(const ProcessColumns& in, bool withPriority = false);
+
+// Body of every single-CPU entry point: runs the policy make(proc) returns
+// over `proc` and gives the JSON document (Result = std::string) or the
+// binary tables (Result = BinaryResult). The policy still runs its own
+// specialized loop (see Specialized). Each policy file's exports are thin
+// wrappers that only pick the table and the factory.
+template <typename Result, typename MakePolicy>
+Result run_policy(std::vector<Process> proc, MakePolicy make, bool withPriority = false, bool withWait = false) {
+    std::unique_ptr<Policy> policy = make(proc);
+    Schedule sched = simulate(proc, *policy);
+    if constexpr (std::is_same_v<Result, BinaryResult>) return BinaryResult(proc, sched);
+    else return to_json(proc, sched, withPriority, withWait);
+}
+
+std::string fcfs_schedule(const std::vector<int>& arrival, const std::vector<int>& burst);
+BinaryResult fcfs_schedule_binary(const std::vector<int>& arrival, const std::vector<int>& burst);
+
+std::string rr_schedule(const std::vector<int>& arrival, const std::vector<int>& burst, int quantum);
+BinaryResult rr_schedule_binary(const std::vector<int>& arrival, const std::vector<int>& burst, int quantum);
+
+std::string sjf_schedule(const std::vector<int>& arrivalTimes, const std::vector<int>& burstTimes);
+std::string sjf_preemptive_schedule(const std::vector<int>& arrivalTimes, const std::vector<int>& burstTimes);
+BinaryResult sjf_schedule_binary(const std::vector<int>& arrivalTimes, const std::vector<int>& burstTimes);
+BinaryResult sjf_preemptive_schedule_binary(const std::vector<int>& arrivalTimes, const std::vector<int>& burstTimes);
+
+std::string priority_schedule(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority);
+std::string priority_preemptive_schedule(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority);
+BinaryResult priority_schedule_binary(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority);
+BinaryResult priority_preemptive_schedule_binary(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority);
+
+// Priority scheduling where waiting processes gain `step` priority levels
+// every `interval` ticks; the JSON adds "max_wait"
+std::string priority_aging_schedule(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority,
+                                    bool preemptive, int step, int interval);
+BinaryResult priority_aging_schedule_binary(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority,
+                                            bool preemptive, int step, int interval);
+
+// quanta[k] is the time slice of level k (level 0 runs first); boostInterval
+// 0 disables the periodic boost
+std::string mlfq_schedule(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& quanta, int boostInterval);
+BinaryResult mlfq_schedule_binary(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& quanta, int boostInterval);
+
+// priority is the nice value (-20..19); non-positive latency/granularity
+// select the defaults
+std::string cfs_schedule(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority, int targetLatency, int minGranularity);
+BinaryResult cfs_schedule_binary(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority, int targetLatency, int minGranularity);
+
+// Any policy policy_by_name() knows with every switch charged `cost`; the
+// overhead shows up as segments with pid SWITCH_PID and in the metrics.
+// Round Robin then runs slice by slice instead of skipping whole rounds.
+std::string switch_cost_schedule(const ProcessInput& input, const std::string& policy, int quantum, const SwitchCost& cost);
+BinaryResult switch_cost_schedule_binary(const ProcessInput& input, const std::string& policy, int quantum, const SwitchCost& cost);
+
+// Same engines reading a ProcessInput filled from JS in place
+std::string fcfs_schedule_input(const ProcessInput& input);
+BinaryResult fcfs_schedule_binary_input(const ProcessInput& input);
+std::string rr_schedule_input(const ProcessInput& input, int quantum);
+BinaryResult rr_schedule_binary_input(const ProcessInput& input, int quantum);
+std::string sjf_schedule_input(const ProcessInput& input);
+std::string sjf_preemptive_schedule_input(const ProcessInput& input);
+BinaryResult sjf_schedule_binary_input(const ProcessInput& input);
+BinaryResult sjf_preemptive_schedule_binary_input(const ProcessInput& input);
+std::string priority_schedule_input(const ProcessInput& input);
+std::string priority_preemptive_schedule_input(const ProcessInput& input);
+BinaryResult priority_schedule_binary_input(const ProcessInput& input);
+BinaryResult priority_preemptive_schedule_binary_input(const ProcessInput& input);
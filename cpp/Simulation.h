@@ -0,0 +1,862 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <ostream>
+#include <utility>
+#include <climits>
+#include <cstdint>
+#include <cmath>
+#include <list>
+#include <set>
+
+// Shared discrete-event core for the schedulers. Instead of stepping the
+// clock one unit at a time, each engine jumps straight to the next event
+// (arrival, quantum expiry or completion) and records what happened over
+// the whole span in one go.
+
+struct Process {
+    int pid;
+    int arrival;
+    int burst;
+    int priority = 0;
+    int remaining = 0;
+    int start = -1;
+    int end = -1;
+    int turnaround = -1;
+    int waiting = -1;
+};
+
+// Input columns of n processes read in place; priority may be null
+struct ProcessColumns {
+    const int* arrival;
+    const int* burst;
+    const int* priority;
+    int n;
+};
+
+inline ProcessColumns columns(const std::vector<int>& arrival, const std::vector<int>& burst) {
+    return { arrival.data(), burst.data(), nullptr, static_cast<int>(arrival.size()) };
+}
+
+inline ProcessColumns columns(const std::vector<int>& arrival, const std::vector<int>& burst,
+                              const std::vector<int>& priority) {
+    return { arrival.data(), burst.data(), priority.data(), static_cast<int>(arrival.size()) };
+}
+
+// Input columns allocated inside the module. JS fills each one with a single
+// TypedArray.set() through a view instead of pushing values one at a time.
+struct ProcessInput {
+    std::vector<int> arrival, burst, priority;
+
+    explicit ProcessInput(int n) : arrival(n), burst(n), priority(n) {}
+
+    int size() const { return static_cast<int>(arrival.size()); }
+    ProcessColumns columns() const { return { arrival.data(), burst.data(), priority.data(), size() }; }
+};
+
+// Hands out processes in (arrival, index) order, each exactly once.
+class ArrivalCursor {
+public:
+    explicit ArrivalCursor(const std::vector<Process>& procs) : procs(procs) { reset(); }
+
+    // `order` must already be sorted by (arrival, index)
+    ArrivalCursor(const std::vector<Process>& procs, std::vector<int> order)
+        : procs(procs), order(std::move(order)) {}
+
+    bool pending() const { return pos < order.size(); }
+
+    // Time of the next arrival not yet admitted, INT_MAX when there is none
+    int nextTime() const { return pending() ? procs[order[pos]].arrival : INT_MAX; }
+
+    // Number of processes handed out so far; seek() restores it after the
+    // table changed only in processes not yet handed out
+    size_t position() const { return pos; }
+    void seek(size_t p) { pos = p; }
+
+    // Back to the first arrival, with the order rebuilt from the table as it
+    // is now; reuses the order's storage
+    void reset() {
+        order.resize(procs.size());
+        for (size_t i = 0; i < order.size(); ++i) order[i] = static_cast<int>(i);
+        std::sort(order.begin(), order.end(), [&](int a, int b) {
+            if (procs[a].arrival != procs[b].arrival) return procs[a].arrival < procs[b].arrival;
+            return a < b;
+        });
+        pos = 0;
+    }
+
+    // Calls f(index) for every process that has arrived by time t
+    template <typename F>
+    void admit(int t, F&& f) {
+        while (pending() && procs[order[pos]].arrival <= t) f(order[pos++]);
+    }
+
+private:
+    const std::vector<Process>& procs;
+    std::vector<int> order;
+    size_t pos = 0;
+};
+
+// Growable ring buffer of process indices, O(1) at both ends. Unlike
+// std::deque it keeps its storage when drained.
+class IndexRing {
+public:
+    bool empty() const { return count == 0; }
+    size_t size() const { return count; }
+
+    void push_back(int i) {
+        grow();
+        buf[(head + count++) & mask()] = i;
+    }
+
+    void push_front(int i) {
+        grow();
+        head = (head - 1) & mask();
+        buf[head] = i;
+        count++;
+    }
+
+    int pop_front() {
+        int i = buf[head];
+        head = (head + 1) & mask();
+        count--;
+        return i;
+    }
+
+    int front() const { return buf[head]; }
+    int back() const { return buf[(head + count - 1) & mask()]; }
+    int pop_back() { return buf[(head + --count) & mask()]; }
+
+    template <typename F>
+    void forEach(F&& f) const {
+        for (size_t k = 0; k < count; ++k) f(buf[(head + k) & mask()]);
+    }
+
+    void clear() { head = count = 0; }
+
+private:
+    size_t mask() const { return buf.size() - 1; }
+
+    // Capacity stays a power of two so wrapping is a mask
+    void grow() {
+        if (count < buf.size()) return;
+        std::vector<int> next(std::max<size_t>(8, buf.size() * 2));
+        for (size_t k = 0; k < count; ++k) next[k] = buf[(head + k) & mask()];
+        buf.swap(next);
+        head = 0;
+    }
+
+    std::vector<int> buf;
+    size_t head = 0, count = 0;
+};
+
+// Binary heap of process indices; top() is the one Better ranks first.
+// Better must be a strict weak ordering that breaks every tie, so the pick
+// never depends on insertion order.
+template <typename Better>
+class ReadyHeap {
+public:
+    explicit ReadyHeap(Better better) : better(better) {}
+
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+    int top() const { return heap.front(); }
+
+    void push(int i) {
+        heap.push_back(i);
+        std::push_heap(heap.begin(), heap.end(), Worse{ better });
+    }
+
+    int pop() {
+        std::pop_heap(heap.begin(), heap.end(), Worse{ better });
+        int i = heap.back();
+        heap.pop_back();
+        return i;
+    }
+
+    // Indices currently queued, in heap (not ranked) order
+    const std::vector<int>& items() const { return heap; }
+
+    void clear() { heap.clear(); }
+
+private:
+    // std heap helpers keep the largest element on top
+    struct Worse {
+        const Better& better;
+        bool operator()(int a, int b) const { return better(b, a); }
+    };
+
+    Better better;
+    std::vector<int> heap;
+};
+
+struct Segment {
+    int start;
+    int end;     // exclusive
+    int pid;
+};
+
+// Segment pid of CPU time spent switching between processes
+constexpr int SWITCH_PID = 0;
+
+// What handing the CPU to a different process costs: `fixed` ticks, plus a
+// cache warm-up of one tick per `cacheInterval` ticks the process has been
+// off the CPU, up to `cacheMax`. A process that never ran, or a
+// non-positive interval, pays the full cacheMax.
+struct SwitchCost {
+    int fixed = 0;
+    int cacheMax = 0;
+    int cacheInterval = 0;
+
+    bool enabled() const { return fixed > 0 || cacheMax > 0; }
+
+    // `away`: ticks since the process last ran, -1 if it never did
+    int ticks(int away) const {
+        int warmup = std::max(0, cacheMax);
+        if (away >= 0 && cacheInterval > 0) warmup = std::min(warmup, away / cacheInterval);
+        return std::max(0, fixed) + warmup;
+    }
+};
+
+// A process joining (enter) or leaving the ready set at a given time
+struct ReadyEvent {
+    int time;
+    int pid;
+    bool enter;
+};
+
+// How the ready set is listed: in queue order or sorted by pid
+enum class ReadyOrder { Fifo, ByPid };
+
+// Which ticks the legacy ready_queue map has an entry for
+enum class ReadyLog { EveryTick, DispatchAndIdle };
+
+// Ready set rebuilt by replaying ReadyEvents in order
+class ReadySet {
+public:
+    explicit ReadySet(ReadyOrder order) : order(order) {}
+
+    void apply(const ReadyEvent& e) {
+        if (order == ReadyOrder::ByPid) {
+            if (e.enter) byPid.insert(e.pid);
+            else byPid.erase(e.pid);
+            return;
+        }
+        if (e.pid >= static_cast<int>(where.size())) where.resize(e.pid + 1, fifo.end());
+        if (e.enter) {
+            where[e.pid] = fifo.insert(fifo.end(), e.pid);
+        } else if (where[e.pid] != fifo.end()) {
+            fifo.erase(where[e.pid]);
+            where[e.pid] = fifo.end();
+        }
+    }
+
+    // Writes the pids as a JSON list body; `extra` (if not -1) is listed too,
+    // at the front of a queue or in pid order otherwise
+    void write(std::ostream& os, int extra = -1) const {
+        bool first = true;
+        each(extra, [&](int pid) {
+            if (!first) os << ",";
+            first = false;
+            os << pid;
+        });
+    }
+
+    // The pids write() lists, in the same order
+    template <typename F>
+    void each(int extra, F put) const {
+        if (order == ReadyOrder::Fifo) {
+            if (extra != -1) put(extra);
+            for (int pid : fifo) put(pid);
+            return;
+        }
+        for (int pid : byPid) {
+            if (extra != -1 && extra < pid) {
+                put(extra);
+                extra = -1;
+            }
+            put(pid);
+        }
+        if (extra != -1) put(extra);
+    }
+
+    std::vector<int> pids() const {
+        if (order == ReadyOrder::Fifo) return std::vector<int>(fifo.begin(), fifo.end());
+        return std::vector<int>(byPid.begin(), byPid.end());
+    }
+
+private:
+    ReadyOrder order;
+    std::list<int> fifo;
+    std::vector<std::list<int>::iterator> where;
+    std::set<int> byPid;
+};
+
+// Streaming quantiles of non-negative ints. The first EXACT values are kept
+// as they are, so small tables get exact nearest-rank percentiles. Past
+// that they are folded into log-linear buckets: one per value below 128,
+// then 64 per power of two (under 1% relative error at the bucket middle),
+// so memory stays fixed however many values arrive.
+class QuantileSketch {
+public:
+    void add(int v) {
+        v = std::max(0, v);
+        n++;
+        largest = std::max(largest, v);
+        if (!sketching) {
+            if (exact.size() < EXACT) {
+                exact.push_back(v);
+                return;
+            }
+            buckets.assign(BUCKETS, 0);
+            for (int x : exact) buckets[bucket(x)]++;
+            exact.clear();
+            sketching = true;
+        }
+        buckets[bucket(v)]++;
+    }
+
+    // Forgets every value but keeps the storage
+    void clear() {
+        exact.clear();
+        sketching = false;
+        n = 0;
+        largest = 0;
+    }
+
+    size_t count() const { return n; }
+    int max() const { return largest; }
+
+    // Smallest value with at least q * count() values at or below it
+    double quantile(double q) const {
+        if (n == 0) return 0;
+        size_t rank = std::min(n, std::max<size_t>(1, static_cast<size_t>(std::ceil(q * n))));
+        if (!sketching) {
+            sorted.assign(exact.begin(), exact.end());
+            std::nth_element(sorted.begin(), sorted.begin() + (rank - 1), sorted.end());
+            return sorted[rank - 1];
+        }
+        size_t seen = 0;
+        for (int i = 0; i < BUCKETS; ++i) {
+            seen += buckets[i];
+            if (seen >= rank) return std::min<double>(largest, middle(i));
+        }
+        return largest;
+    }
+
+private:
+    static constexpr size_t EXACT = 4096;
+    static constexpr int LINEAR = 128;                     // values below get a bucket each
+    static constexpr int SUB = 64;                         // buckets per power of two above
+    static constexpr int BUCKETS = LINEAR + (31 - 7) * SUB;
+
+    static int bucket(int v) {
+        if (v < LINEAR) return v;
+        int msb = 31 - __builtin_clz(static_cast<unsigned>(v));
+        return LINEAR + (msb - 7) * SUB + ((v >> (msb - 6)) & (SUB - 1));
+    }
+
+    static double middle(int i) {
+        if (i < LINEAR) return i;
+        int msb = 7 + (i - LINEAR) / SUB, sub = (i - LINEAR) % SUB;
+        double width = std::ldexp(1.0, msb - 6);
+        return (SUB + sub) * width + (width - 1) / 2;
+    }
+
+    std::vector<int> exact;
+    std::vector<uint32_t> buckets;
+    bool sketching = false;               // values go to buckets, not exact
+    mutable std::vector<int> sorted;      // scratch for quantile()
+    size_t n = 0;
+    int largest = 0;
+};
+
+struct Percentiles {
+    double p50 = 0, p95 = 0, p99 = 0, max = 0;
+};
+
+// Figures beyond the two averages, reported by every engine
+struct Metrics {
+    double averageResponse = 0;     // first run - arrival
+    double throughput = 0;          // completions per tick over [first arrival, makespan)
+    double cpuUtilization = 0;      // share of that span spent running processes, over all CPUs
+    int idle = 0;                   // CPU ticks in that span with nothing running
+    int switchOverhead = 0;         // CPU ticks in that span spent switching (see SwitchCost)
+    int contextSwitches = 0;        // CPU handed to a different pid
+    Percentiles waiting, turnaround, response;
+};
+
+// Running totals behind Metrics, fed as the loop completes processes and
+// runs them, so nothing is traversed again afterwards
+class MetricsTally {
+public:
+    void complete(const Process& p) {
+        waiting.add(p.waiting);
+        turnaround.add(p.turnaround);
+        response.add(p.start - p.arrival);
+        totalResponse += p.start - p.arrival;
+        firstArrival = std::min(firstArrival, p.arrival);
+    }
+
+    void run(long long ticks) { busy += ticks; }
+    void switching(long long ticks) { overhead += ticks; }
+    long long busyTicks() const { return busy; }
+    long long overheadTicks() const { return overhead; }
+
+    // Back to an empty tally, keeping the sketches' storage
+    void clear() {
+        waiting.clear();
+        turnaround.clear();
+        response.clear();
+        totalResponse = 0;
+        firstArrival = INT_MAX;
+        busy = overhead = 0;
+    }
+
+    // Drops the per-process figures, keeping the busy and switching time
+    void clearCompletions() {
+        long long ran = busy, switched = overhead;
+        clear();
+        busy = ran;
+        overhead = switched;
+    }
+
+    Metrics summary(int makespan, int contextSwitches, int cpus = 1) const {
+        Metrics m;
+        m.contextSwitches = contextSwitches;
+        m.switchOverhead = static_cast<int>(overhead);
+        size_t n = waiting.count();
+        if (n == 0) return m;
+        long long span = std::max(0, makespan - firstArrival);
+        m.averageResponse = totalResponse / n;
+        if (span > 0) {
+            m.throughput = n / double(span);
+            m.cpuUtilization = busy / double(span * cpus);
+        }
+        m.idle = static_cast<int>(std::max(0LL, span * cpus - busy - overhead));
+        m.waiting = percentiles(waiting);
+        m.turnaround = percentiles(turnaround);
+        m.response = percentiles(response);
+        return m;
+    }
+
+private:
+    static Percentiles percentiles(const QuantileSketch& s) {
+        return { s.quantile(0.50), s.quantile(0.95), s.quantile(0.99), double(s.max()) };
+    }
+
+    QuantileSketch waiting, turnaround, response;
+    double totalResponse = 0;
+    int firstArrival = INT_MAX;
+    long long busy = 0, overhead = 0;
+};
+
+// `rounds` full Round Robin rounds over the same queue, stored as one record.
+// Each round dispatches roundPids[first .. first + count) in order for one
+// quantum apiece. The *At fields say where the block sits among the flat
+// records, which skip it.
+struct RoundBlock {
+    int start;
+    int quantum;
+    int rounds;
+    int first;
+    int count;
+    int timelineAt, segmentsAt, eventsAt;
+
+    int end() const { return start + rounds * count * quantum; }
+};
+
+// Everything an engine records while simulating: the CPU schedule as
+// [start, end) intervals and the ready set as enter/leave deltas, both in
+// time order. Memory grows with the number of events, not the time span;
+// the per-tick views are rebuilt on demand. Stretches of whole Round Robin
+// rounds are kept as RoundBlocks rather than one record per slice.
+class Schedule {
+public:
+    std::vector<std::pair<int, int>> timeline;   // {time, pid}
+    std::vector<Segment> segments;               // {start, end, pid}
+    std::vector<ReadyEvent> readyEvents;         // non-decreasing time
+    std::vector<RoundBlock> rounds;
+    std::vector<int> roundPids;
+    std::vector<int> completed;
+    double totalTurnaround = 0, totalWaiting = 0;
+    int makespan = 0;
+    int contextSwitches = 0;                     // CPU handed to a different pid
+    MetricsTally tally;
+
+    // listDispatched: the legacy ready_queue still shows a process on the
+    // tick it is dispatched (FCFS and non-preemptive SJF did so)
+    Schedule(ReadyOrder order, ReadyLog log, bool listDispatched = false)
+        : order(order), log(log), listDispatched(listDispatched) {}
+
+    ReadyOrder readyOrder() const { return order; }
+
+    // Empties the schedule for a new run, keeping every buffer's storage
+    void reset(ReadyOrder readyOrder, ReadyLog readyLog, bool lists) {
+        timeline.clear();
+        segments.clear();
+        readyEvents.clear();
+        rounds.clear();
+        roundPids.clear();
+        completed.clear();
+        totalTurnaround = totalWaiting = 0;
+        makespan = 0;
+        contextSwitches = 0;
+        tally.clear();
+        order = readyOrder;
+        log = readyLog;
+        listDispatched = lists;
+        lastPid = -1;
+        rewound = false;
+    }
+
+    void dispatch(int t, int pid) { timeline.emplace_back(t, pid); }
+
+    void run(int start, int end, int pid) {
+        if (start >= end) return;
+        switchTo(pid);
+        tally.run(end - start);
+        if (!segments.empty() && segments.back().end == start && segments.back().pid == pid)
+            segments.back().end = end;
+        else
+            segments.push_back({ start, end, pid });
+    }
+
+    // CPU time spent switching to the next process, kept as its own segment
+    // and left out of contextSwitches, which the run that follows counts
+    void overhead(int start, int end) {
+        if (start >= end) return;
+        tally.switching(end - start);
+        segments.push_back({ start, end, SWITCH_PID });
+    }
+
+    // Records k rounds of `pids` (queue order) starting at `start`
+    void repeat(int start, int quantum, int k, const std::vector<int>& pids) {
+        int m = static_cast<int>(pids.size());
+        rounds.push_back({ start, quantum, k, static_cast<int>(roundPids.size()), m,
+                           static_cast<int>(timeline.size()), static_cast<int>(segments.size()),
+                           static_cast<int>(readyEvents.size()) });
+        roundPids.insert(roundPids.end(), pids.begin(), pids.end());
+        tally.run((long long)k * m * quantum);
+        switchTo(pids.front());
+        if (m > 1) contextSwitches += k * m - 1;
+        lastPid = pids.back();
+    }
+
+    void enter(int t, int pid) { readyEvents.push_back({ t, pid, true }); }
+    void leave(int t, int pid) { readyEvents.push_back({ t, pid, false }); }
+
+    void complete(Process& p, int t) {
+        p.end = t;
+        p.turnaround = p.end - p.arrival;
+        p.waiting = p.turnaround - p.burst;
+        totalTurnaround += p.turnaround;
+        totalWaiting += p.waiting;
+        completed.push_back(p.pid);
+        makespan = std::max(makespan, t);
+        tally.complete(p);
+    }
+
+    // Metrics of the run; after a rewind() the per-process figures are
+    // rebuilt from the finished rows of `procs`
+    Metrics metrics(const std::vector<Process>& procs) const {
+        if (!rewound) return tally.summary(makespan, contextSwitches);
+        MetricsTally fresh = tally;
+        fresh.clearCompletions();
+        for (const auto& p : procs)
+            if (p.end >= 0) fresh.complete(p);
+        return fresh.summary(makespan, contextSwitches);
+    }
+
+    // Recorded sizes and totals at one point of a run; rewind() drops
+    // everything recorded after it
+    struct Mark {
+        size_t timeline, segments, readyEvents, rounds, roundPids, completed;
+        int lastSegmentEnd;
+        double totalTurnaround, totalWaiting;
+        int makespan, contextSwitches, lastPid;
+        long long busy, overhead;
+    };
+
+    Mark mark() const {
+        return { timeline.size(), segments.size(), readyEvents.size(), rounds.size(), roundPids.size(),
+                 completed.size(), segments.empty() ? 0 : segments.back().end,
+                 totalTurnaround, totalWaiting, makespan, contextSwitches, lastPid, tally.busyTicks(),
+                 tally.overheadTicks() };
+    }
+
+    void rewind(const Mark& m) {
+        timeline.resize(m.timeline);
+        segments.resize(m.segments);
+        if (!segments.empty()) segments.back().end = m.lastSegmentEnd;   // undo merges
+        readyEvents.resize(m.readyEvents);
+        rounds.resize(m.rounds);
+        roundPids.resize(m.roundPids);
+        completed.resize(m.completed);
+        totalTurnaround = m.totalTurnaround;
+        totalWaiting = m.totalWaiting;
+        makespan = m.makespan;
+        contextSwitches = m.contextSwitches;
+        lastPid = m.lastPid;
+        tally.clearCompletions();
+        tally.run(m.busy - tally.busyTicks());
+        tally.switching(m.overhead - tally.overheadTicks());
+        rewound = true;
+    }
+
+    // Copy with every RoundBlock spelled out as the flat records the loop
+    // would have made slice by slice
+    Schedule expanded() const {
+        Schedule out(order, log, listDispatched);
+        size_t ti = 0, si = 0, ei = 0;
+        auto flatUpTo = [&](size_t tEnd, size_t sEnd, size_t eEnd) {
+            out.timeline.insert(out.timeline.end(), timeline.begin() + ti, timeline.begin() + tEnd);
+            for (; si < sEnd; ++si) {
+                const Segment& s = segments[si];
+                if (s.pid == SWITCH_PID) out.overhead(s.start, s.end);
+                else out.run(s.start, s.end, s.pid);
+            }
+            out.readyEvents.insert(out.readyEvents.end(), readyEvents.begin() + ei, readyEvents.begin() + eEnd);
+            ti = tEnd;
+            ei = eEnd;
+        };
+        for (const auto& b : rounds) {
+            flatUpTo(b.timelineAt, b.segmentsAt, b.eventsAt);
+            int t = b.start;
+            for (int r = 0; r < b.rounds; ++r) {
+                for (int j = 0; j < b.count; ++j, t += b.quantum) {
+                    int pid = roundPids[b.first + j];
+                    out.dispatch(t, pid);
+                    out.leave(t, pid);
+                    out.run(t, t + b.quantum, pid);
+                    out.enter(t + b.quantum, pid);
+                }
+            }
+        }
+        flatUpTo(timeline.size(), segments.size(), readyEvents.size());
+        out.completed = completed;
+        out.totalTurnaround = totalTurnaround;
+        out.totalWaiting = totalWaiting;
+        out.makespan = makespan;
+        out.contextSwitches = contextSwitches;
+        out.tally = tally;
+        out.rewound = rewound;
+        return out;
+    }
+
+    // Longest single stretch any process spent in the ready queue
+    int maxWait() const {
+        since.clear();
+        int longest = 0;
+        size_t ev = 0;
+        auto entered = [&](int pid) -> int& {
+            if (pid >= static_cast<int>(since.size())) since.resize(pid + 1, 0);
+            return since[pid];
+        };
+        auto replay = [&](size_t to) {
+            for (; ev < to; ++ev) {
+                const ReadyEvent& e = readyEvents[ev];
+                if (e.enter) entered(e.pid) = e.time;
+                else longest = std::max(longest, e.time - entered(e.pid));
+            }
+        };
+        // In whole rounds a process waits once until its first slice, then
+        // for the others' slices between its own
+        for (const auto& b : rounds) {
+            replay(b.eventsAt);
+            for (int j = 0; j < b.count; ++j) {
+                int& from = entered(roundPids[b.first + j]);
+                longest = std::max(longest, b.start + j * b.quantum - from);
+                if (b.rounds > 1) longest = std::max(longest, (b.count - 1) * b.quantum);
+                from = b.start + ((b.rounds - 1) * b.count + j + 1) * b.quantum;
+            }
+        }
+        replay(readyEvents.size());
+        return longest;
+    }
+
+    // Process on the CPU at tick t, -1 when idle, SWITCH_PID while switching
+    int runningAt(int t) const {
+        auto b = std::upper_bound(rounds.begin(), rounds.end(), t,
+            [](int time, const RoundBlock& r) { return time < r.start; });
+        if (b != rounds.begin() && t < (--b)->end())
+            return roundPids[b->first + (t - b->start) / b->quantum % b->count];
+
+        auto it = std::upper_bound(segments.begin(), segments.end(), t,
+            [](int time, const Segment& s) { return time < s.start; });
+        if (it == segments.begin()) return -1;
+        --it;
+        return t < it->end ? it->pid : -1;
+    }
+
+    // Processes waiting for the CPU at tick t (the running one excluded)
+    std::vector<int> readyAt(int t) const {
+        if (!rounds.empty()) return expanded().readyAt(t);
+        ReadySet set(order);
+        for (const auto& e : readyEvents) {
+            if (e.time > t) break;
+            set.apply(e);
+        }
+        return set.pids();
+    }
+
+    // "time":[pids] for every tick the engine logs; both writers read the
+    // flat records only, so call them on expanded()
+    void writeReadyQueue(std::ostream& os) const {
+        bool first = true;
+        forEachReadyEntry([&](int t, const ReadySet& set, int extra) {
+            if (!first) os << ",";
+            first = false;
+            os << "\"" << t << "\":[";
+            set.write(os, extra);
+            os << "]";
+        });
+    }
+
+    // Calls fn(t, set, extra) for every tick the legacy ready_queue map has
+    // an entry for, in order; the entry is set.write(os, extra)
+    template <typename F>
+    void forEachReadyEntry(F fn) const {
+        ReadySet set(order);
+        size_t ev = 0, disp = 0, seg = 0;
+        auto entry = [&](int t) {
+            while (ev < readyEvents.size() && readyEvents[ev].time <= t) set.apply(readyEvents[ev++]);
+            while (disp < timeline.size() && timeline[disp].first < t) disp++;
+            bool dispatched = disp < timeline.size() && timeline[disp].first == t;
+            fn(t, set, listDispatched && dispatched ? timeline[disp].second : -1);
+        };
+
+        if (log == ReadyLog::EveryTick) {
+            for (int t = 0; t < makespan; ++t) entry(t);
+            return;
+        }
+        // Dispatch ticks plus every idle tick
+        int t = 0;
+        while (t < makespan) {
+            while (seg < segments.size() && segments[seg].end <= t) seg++;
+            if (seg < segments.size() && segments[seg].start <= t) {
+                while (disp < timeline.size() && timeline[disp].first < t) disp++;
+                if (disp < timeline.size() && timeline[disp].first == t) entry(t);
+                int next = disp < timeline.size() ? std::min(timeline[disp].first, segments[seg].end) : segments[seg].end;
+                t = next > t ? next : t + 1;
+            } else {
+                entry(t++);
+            }
+        }
+    }
+
+    // "time":pid for every busy tick, SWITCH_PID while switching
+    void writeRunning(std::ostream& os) const {
+        bool first = true;
+        for (const auto& s : segments) {
+            for (int t = s.start; t < s.end; ++t) {
+                if (!first) os << ",";
+                first = false;
+                os << "\"" << t << "\":" << s.pid;
+            }
+        }
+    }
+
+private:
+    void switchTo(int pid) {
+        if (lastPid != -1 && pid != lastPid) contextSwitches++;
+        lastPid = pid;
+    }
+
+    ReadyOrder order;
+    ReadyLog log;
+    bool listDispatched;
+    int lastPid = -1;   // last pid on the CPU, for contextSwitches
+    mutable std::vector<int> since;   // scratch for maxWait()
+    bool rewound = false;
+};
+
+// Flat Int32 form of a finished run for callers that skip JSON. Every table
+// is one contiguous array with a fixed number of fields per record.
+struct BinaryResult {
+    static constexpr int PROCESS_FIELDS = 8;  // pid, arrival, burst, priority, start, end, turnaround, waiting
+    static constexpr int SEGMENT_FIELDS = 3;  // start, end, pid (SWITCH_PID for switch overhead)
+    static constexpr int READY_FIELDS = 3;    // time, pid, 1 = enter / 0 = leave
+    // start, quantum, rounds, first, count, segment index, ready event index;
+    // see RoundBlock. segments and readyEvents skip these stretches.
+    static constexpr int ROUND_FIELDS = 7;
+
+    std::vector<int32_t> processTable;
+    std::vector<int32_t> segments;
+    std::vector<int32_t> readyEvents;
+    std::vector<int32_t> rounds;
+    std::vector<int32_t> roundPids;
+    std::vector<int32_t> completed;
+    double averageTurnaround = 0, averageWaiting = 0;
+    int contextSwitches = 0;
+    int maxWait = 0;           // longest single stretch in the ready queue
+    Metrics metrics;
+
+    BinaryResult() = default;
+
+    BinaryResult(const std::vector<Process>& procs, const Schedule& sched) { assign(procs, sched); }
+
+    // Refills the tables from a run, reusing their storage
+    void assign(const std::vector<Process>& procs, const Schedule& sched) {
+        processTable.clear();
+        segments.clear();
+        readyEvents.clear();
+        rounds.clear();
+        processTable.reserve(procs.size() * PROCESS_FIELDS);
+        for (const auto& p : procs) {
+            processTable.insert(processTable.end(),
+                { p.pid, p.arrival, p.burst, p.priority, p.start, p.end, p.turnaround, p.waiting });
+        }
+        segments.reserve(sched.segments.size() * SEGMENT_FIELDS);
+        for (const auto& s : sched.segments) {
+            segments.insert(segments.end(), { s.start, s.end, s.pid });
+        }
+        readyEvents.reserve(sched.readyEvents.size() * READY_FIELDS);
+        for (const auto& e : sched.readyEvents) {
+            readyEvents.insert(readyEvents.end(), { e.time, e.pid, e.enter ? 1 : 0 });
+        }
+        rounds.reserve(sched.rounds.size() * ROUND_FIELDS);
+        for (const auto& b : sched.rounds) {
+            rounds.insert(rounds.end(), { b.start, b.quantum, b.rounds, b.first, b.count, b.segmentsAt, b.eventsAt });
+        }
+        roundPids.assign(sched.roundPids.begin(), sched.roundPids.end());
+        completed.assign(sched.completed.begin(), sched.completed.end());
+        averageTurnaround = averageWaiting = 0;
+        if (!procs.empty()) {
+            averageTurnaround = sched.totalTurnaround / procs.size();
+            averageWaiting = sched.totalWaiting / procs.size();
+        }
+        contextSwitches = sched.contextSwitches;
+        maxWait = sched.maxWait();
+        metrics = sched.metrics(procs);
+    }
+};
+
+// The legacy running_process and ready_queue maps as flat per-tick arrays,
+// for views that step through time without parsing JSON
+struct TickTables {
+    static constexpr int READY_AT_FIELDS = 2;  // offset into ready, count (-1 = tick not logged)
+
+    std::vector<int32_t> running;   // pid per tick up to the makespan, -1 when idle
+    std::vector<int32_t> readyAt;
+    std::vector<int32_t> ready;     // every logged ready list, back to back
+
+    TickTables() = default;
+
+    explicit TickTables(const Schedule& sched) {
+        if (!sched.rounds.empty()) {
+            *this = TickTables(sched.expanded());
+            return;
+        }
+        running.assign(sched.makespan, -1);
+        for (const auto& s : sched.segments)
+            std::fill(running.begin() + s.start, running.begin() + s.end, s.pid);
+        readyAt.assign(size_t(sched.makespan) * READY_AT_FIELDS, -1);
+        sched.forEachReadyEntry([&](int t, const ReadySet& set, int extra) {
+            readyAt[t * READY_AT_FIELDS] = ready.size();
+            set.each(extra, [&](int pid) { ready.push_back(pid); });
+            readyAt[t * READY_AT_FIELDS + 1] = ready.size() - readyAt[t * READY_AT_FIELDS];
+        });
+    }
+};
@@ -0,0 +1,39 @@
+#include "Simulator.h"
+
+Simulator::Simulator(const std::string& policy, int quantum) {
+    setPolicy(policy, quantum);
+}
+
+void Simulator::setPolicy(const std::string& policy, int quantum) {
+    current = nullptr;
+    for (auto& slot : slots)
+        if (slot.name == policy) current = &slot;
+    if (current) {
+        current->policy->setQuantum(quantum);
+    } else {
+        slots.push_back({ policy, policy_by_name(policy, proc, quantum) });
+        current = &slots.back();
+    }
+    withPriority = policy == "priority" || policy == "priority-preemptive";
+    byArrival = policy == "fcfs";
+}
+
+const BinaryResult& Simulator::run(const ProcessColumns& in) {
+    proc.resize(in.n);
+    for (int i = 0; i < in.n; ++i)
+        proc[i] = { i + 1, in.arrival[i], in.burst[i], withPriority ? in.priority[i] : 0, in.burst[i] };
+    if (byArrival) sort_by_arrival(proc);
+
+    Policy& policy = *current->policy;
+    policy.clear();
+    sched.reset(policy.readyOrder(), policy.readyLog(), policy.listsDispatched());
+    arrivals.reset();
+    state.reset();
+    simulate(proc, policy, sched, arrivals, state, nullptr, cost);
+    out.assign(proc, sched);
+    return out;
+}
+
+std::string Simulator::json() const {
+    return to_json(proc, sched, withPriority);
+}
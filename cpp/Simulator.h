@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Scheduler.h"
+#include <vector>
+#include <string>
+#include <memory>
+
+// A long-lived simulator for sweeps and replays, which run thousands of
+// workloads back to back. It owns everything a run needs: the process
+// table, arrival order, ready queues, loop state, recorded Schedule and
+// result tables. Between runs it clears them instead of freeing them, so
+// once they have grown to the largest workload seen, a run makes no heap
+// allocations. Results match the policy's own *_binary entry point. Not
+// thread-safe; give each thread its own instance.
+class Simulator {
+public:
+    // policy_by_name() names; throws std::invalid_argument otherwise
+    Simulator(const std::string& policy, int quantum);
+    Simulator(const Simulator&) = delete;   // the policies refer to `proc`
+    Simulator& operator=(const Simulator&) = delete;
+
+    // Policy for the following runs. One queue is kept per policy name, and
+    // a new quantum retunes the Round Robin one in place, so switching back
+    // and forth (or sweeping quanta) does not allocate either, and the kept
+    // queues never outnumber the policy names.
+    void setPolicy(const std::string& policy, int quantum);
+    void setSwitchCost(const SwitchCost& cost) { this->cost = cost; }
+
+    // Schedules the rows; the result stays valid until the next run
+    const BinaryResult& run(const ProcessColumns& input);
+    const BinaryResult& run(const ProcessInput& input) { return run(input.columns()); }
+    const BinaryResult& result() const { return out; }
+
+    // The last run as the policy's JSON document (this one allocates)
+    std::string json() const;
+
+private:
+    struct Slot {
+        std::string name;
+        std::unique_ptr<Policy> policy;
+    };
+
+    std::vector<Process> proc;
+    ArrivalCursor arrivals{ proc };
+    std::vector<Slot> slots;
+    Slot* current = nullptr;
+    bool withPriority = false;   // priority policies keep the priority column
+    bool byArrival = false;      // FCFS lists its table by arrival
+    SwitchCost cost;
+    Schedule sched{ ReadyOrder::Fifo, ReadyLog::EveryTick };
+    LoopState state;
+    BinaryResult out;
+};
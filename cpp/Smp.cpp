@@ -0,0 +1,248 @@
+#include "Smp.h"
+#include <queue>
+#include <algorithm>
+#include <climits>
+
+namespace {
+
+struct Core {
+    std::unique_ptr<Policy> queue;
+    int queued = 0;        // processes waiting in `queue`
+    int running = -1;      // process index, -1 when idle
+    bool held = false;     // slice just ended, process goes back after arrivals
+    int since = 0;         // start of the current run
+    unsigned version = 0;  // bumped on every stop so stale RunEnds are skipped
+    long long work = 0;    // remaining ticks of the running and queued processes, as of `since`
+    int roundCheck = 0;    // fresh slices left before the next fast-forward attempt
+};
+
+// A core's current run ends at `time`
+struct RunEnd {
+    int time;
+    int core;
+    unsigned version;
+};
+
+struct Later {
+    bool operator()(const RunEnd& a, const RunEnd& b) const {
+        return a.time != b.time ? a.time > b.time : a.core > b.core;
+    }
+};
+
+}  // namespace
+
+SmpResult simulate_smp(std::vector<Process>& proc, const SmpConfig& config, const PolicyFactory& make) {
+    int n = proc.size();
+    int ncores = std::max(1, config.cores);
+    std::vector<Core> cores(ncores);
+    for (auto& c : cores) c.queue = make();
+    bool preemptive = cores[0].queue->preemptive();
+    int slice = cores[0].queue->slice();
+
+    SmpSchedule sched(ncores);
+    ArrivalCursor arrivals(proc);
+    std::priority_queue<RunEnd, std::vector<RunEnd>, Later> ends;
+    std::vector<int> lastCore(n, -1);
+    std::vector<std::pair<int, int>> requeue;   // {core, index} whose slice ran out
+    std::vector<int> started;                   // cores that started a run this event
+    int completed = 0, queuedTotal = 0;
+
+    auto enqueue = [&](int c, int i) {
+        cores[c].queue->push(i);
+        cores[c].queued++;
+        cores[c].work += proc[i].remaining;
+        queuedTotal++;
+    };
+    auto dequeue = [&](int c) {
+        cores[c].queued--;
+        queuedTotal--;
+        int i = cores[c].queue->pop();
+        cores[c].work -= proc[i].remaining;
+        return i;
+    };
+
+    // Takes core c off its process at t; returns the process if unfinished
+    auto stop = [&](int c, int t) {
+        Core& core = cores[c];
+        int i = core.running;
+        Process& p = proc[i];
+        sched.run(c, core.since, t, p.pid);
+        core.work -= p.remaining;
+        p.remaining -= t - core.since;
+        core.running = -1;
+        core.version++;
+        if (p.remaining > 0) return i;
+        core.queue->finished(i);
+        sched.complete(p, t);
+        completed++;
+        return -1;
+    };
+
+    auto start = [&](int c, int i, int t) {
+        Core& core = cores[c];
+        Process& p = proc[i];
+        if (p.start == -1) p.start = t;
+        if (lastCore[i] != -1 && lastCore[i] != c) sched.migrations++;
+        lastCore[i] = c;
+        core.running = i;
+        core.since = t;
+        core.work += p.remaining;
+        started.push_back(c);
+        ends.push({ t + std::min(p.remaining, slice), c, core.version });
+    };
+
+    // Lowest queued + running count, lowest core id on ties
+    auto leastLoaded = [&] {
+        int best = 0, bestLoad = INT_MAX;
+        for (int c = 0; c < ncores; ++c) {
+            int load = cores[c].queued + (cores[c].running != -1 || cores[c].held);
+            if (load < bestLoad) {
+                best = c;
+                bestLoad = load;
+            }
+        }
+        return best;
+    };
+
+    auto longestQueue = [&] {
+        int best = 0;
+        for (int c = 1; c < ncores; ++c)
+            if (cores[c].queued > cores[best].queued) best = c;
+        return best;
+    };
+
+    auto rebalance = [&] {
+        while (true) {
+            int hi = longestQueue(), lo = 0;
+            for (int c = 1; c < ncores; ++c)
+                if (cores[c].queued < cores[lo].queued) lo = c;
+            if (cores[hi].queued - cores[lo].queued <= 1) return;
+            enqueue(lo, dequeue(hi));
+        }
+    };
+
+    // Idle core c takes its own best process, or steals one, at t
+    auto pick = [&](int c, int t) {
+        while (true) {
+            int i;
+            if (cores[c].queued > 0) {
+                cores[c].queue->advance(t);
+                i = dequeue(c);
+            } else if (config.steal && queuedTotal > 0) {
+                i = dequeue(longestQueue());
+                sched.steals++;
+            } else {
+                return;
+            }
+            if (proc[i].remaining > 0) {
+                start(c, i, t);
+                return;
+            }
+            if (proc[i].start == -1) proc[i].start = t;
+            sched.complete(proc[i], t);
+            completed++;
+        }
+    };
+
+    int interval = config.rebalanceInterval;
+    int nextRebalance = interval > 0 ? interval : INT_MAX;
+    int t = 0;
+
+    // Round Robin on core c, whose process starts a fresh slice at t: the
+    // core's processes keep taking full slices in the same order, as in
+    // skip_rounds(), until one of them is about to finish or something else
+    // reaches the core: an arrival, a rebalancing pass, or (with stealing)
+    // another core running out of work. Runs k such rounds at once, ending
+    // before all of those; tried at most once every m fresh slices.
+    bool roundRobin = cores[0].queue->roundRobin() && !preemptive;
+    std::vector<int> round, pids;
+    auto skipRounds = [&](int c) {
+        Core& core = cores[c];
+        if (--core.roundCheck > 0) return;
+        core.roundCheck = core.queued + 1;
+
+        long long bound = std::min(arrivals.nextTime(), interval > 0 ? nextRebalance : INT_MAX);
+        if (config.steal) {
+            for (int d = 0; d < ncores; ++d) {
+                if (d == c) continue;
+                if (cores[d].running == -1) return;
+                bound = std::min(bound, cores[d].since + cores[d].work);
+            }
+        }
+        core.queue->queuedInto(round);
+        round.insert(round.begin(), core.running);
+        long long m = round.size(), length = m * slice;
+        long long k = (std::min<long long>(bound - 1, INT_MAX) - t) / length;
+        for (int i : round) k = std::min<long long>(k, (proc[i].remaining - 1) / slice);
+        if (k < 2) return;
+
+        pids.resize(m);
+        for (int j = 0; j < m; ++j) {
+            Process& p = proc[round[j]];
+            if (p.start == -1) p.start = t + j * slice;
+            if (lastCore[round[j]] != -1 && lastCore[round[j]] != c) sched.migrations++;
+            lastCore[round[j]] = c;
+            p.remaining -= k * slice;
+            pids[j] = p.pid;
+        }
+        int from = t + k * length;
+        if (m > 1) sched.repeat(c, t, slice, k, pids);
+        else sched.run(c, t, from, pids[0]);
+        core.work -= k * length;
+        core.since = from;
+        core.version++;
+        ends.push({ from + std::min(proc[core.running].remaining, slice), c, core.version });
+    };
+
+    while (completed < n) {
+        while (!ends.empty() && ends.top().version != cores[ends.top().core].version) ends.pop();
+        int next = arrivals.nextTime();
+        if (!ends.empty()) next = std::min(next, ends.top().time);
+        if (queuedTotal > 0) next = std::min(next, nextRebalance);
+        if (next == INT_MAX) break;
+        t = std::max(t, next);
+
+        // Runs ending now: finished processes complete, the rest queue up
+        // again on the same core after this tick's arrivals
+        requeue.clear();
+        while (!ends.empty() && ends.top().time == t) {
+            RunEnd e = ends.top();
+            ends.pop();
+            if (e.version != cores[e.core].version) continue;
+            int i = stop(e.core, t);
+            if (i != -1) {
+                requeue.emplace_back(e.core, i);
+                cores[e.core].held = true;
+            }
+        }
+
+        // A preemptive core gives up its process to re-pick with the newcomer
+        arrivals.admit(t, [&](int i) {
+            int c = leastLoaded();
+            enqueue(c, i);
+            if (preemptive && cores[c].running != -1) {
+                int r = stop(c, t);
+                if (r != -1) enqueue(c, r);
+            }
+        });
+
+        for (const auto& [c, i] : requeue) {
+            enqueue(c, i);
+            cores[c].held = false;
+        }
+
+        if (interval > 0 && t >= nextRebalance) {
+            rebalance();
+            nextRebalance = (t / interval + 1) * interval;
+        }
+
+        for (int c = 0; c < ncores; ++c)
+            if (cores[c].running == -1) pick(c, t);
+        if (roundRobin)
+            for (int c : started) skipRounds(c);
+        started.clear();
+    }
+
+    sched.finish();
+    return SmpResult(proc, sched, ncores);
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "Scheduler.h"
+#include <vector>
+#include <memory>
+#include <functional>
+#include <cstdint>
+
+// Multiprocessor mode: every core owns a run queue (one Policy instance per
+// core) and picks from it independently. Arrivals go to the least loaded
+// core; an idle core with an empty queue can steal from the longest queue,
+// and queues can be evened out every rebalanceInterval ticks. Like the
+// single-CPU loop it jumps between events, so the cost grows with the
+// number of dispatches, not with cores x time; under Round Robin each core
+// also skips whole rounds between the events that can reach it.
+
+struct SmpConfig {
+    int cores = 1;
+    bool steal = true;            // idle core takes work from the longest queue
+    int rebalanceInterval = 0;    // ticks between rebalancing passes, 0 = never
+};
+
+struct CoreSegment {
+    int core;
+    int start;
+    int end;     // exclusive
+    int pid;
+};
+
+// `rounds` full Round Robin rounds of `count` processes on one core, like
+// RoundBlock: slices of `quantum` from `start`, pids at roundPids[first..]
+struct CoreRounds {
+    int core;
+    int start;
+    int quantum;
+    int rounds;
+    int first;
+    int count;
+    int segmentsAt;   // index in `segments` of the first segment after the rounds
+};
+
+// What the multiprocessor loop records: per-core running intervals plus
+// the totals the single-CPU Schedule keeps
+class SmpSchedule {
+public:
+    std::vector<CoreSegment> segments;   // grouped by core, time order within a core
+    std::vector<CoreRounds> rounds;      // grouped by core; segments skip these stretches
+    std::vector<int> roundPids;
+    std::vector<int> completed;
+    double totalTurnaround = 0, totalWaiting = 0;
+    int makespan = 0;
+    int migrations = 0;    // dispatches on a different core than the process last ran on
+    int steals = 0;        // processes taken from another core's queue by an idle core
+    int contextSwitches = 0;
+    MetricsTally tally;
+
+    explicit SmpSchedule(int cores) : perCore(cores), perCoreRounds(cores), lastPid(cores, -1) {}
+
+    void run(int core, int start, int end, int pid) {
+        if (start >= end) return;
+        auto& segs = perCore[core];
+        if (lastPid[core] != -1 && lastPid[core] != pid) contextSwitches++;
+        lastPid[core] = pid;
+        tally.run(end - start);
+        if (!segs.empty() && segs.back().end == start && segs.back().pid == pid)
+            segs.back().end = end;
+        else
+            segs.push_back({ core, start, end, pid });
+    }
+
+    // Records k rounds of `pids` (queue order, two or more) on `core` from `start`
+    void repeat(int core, int start, int quantum, int k, const std::vector<int>& pids) {
+        int m = pids.size();
+        perCoreRounds[core].push_back({ core, start, quantum, k, static_cast<int>(roundPids.size()), m,
+                                        static_cast<int>(perCore[core].size()) });
+        roundPids.insert(roundPids.end(), pids.begin(), pids.end());
+        tally.run((long long)k * m * quantum);
+        if (lastPid[core] != -1 && lastPid[core] != pids.front()) contextSwitches++;
+        contextSwitches += k * m - 1;
+        lastPid[core] = pids.back();
+    }
+
+    void complete(Process& p, int t) {
+        p.end = t;
+        p.turnaround = p.end - p.arrival;
+        p.waiting = p.turnaround - p.burst;
+        totalTurnaround += p.turnaround;
+        totalWaiting += p.waiting;
+        completed.push_back(p.pid);
+        makespan = std::max(makespan, t);
+        tally.complete(p);
+    }
+
+    // Moves the per-core intervals into `segments` and `rounds`
+    void finish() {
+        for (size_t c = 0; c < perCore.size(); ++c) {
+            for (auto b : perCoreRounds[c]) {
+                b.segmentsAt += static_cast<int>(segments.size());
+                rounds.push_back(b);
+            }
+            segments.insert(segments.end(), perCore[c].begin(), perCore[c].end());
+        }
+        perCore.clear();
+        perCoreRounds.clear();
+    }
+
+private:
+    std::vector<std::vector<CoreSegment>> perCore;
+    std::vector<std::vector<CoreRounds>> perCoreRounds;
+    std::vector<int> lastPid;   // per core, for contextSwitches
+};
+
+// Flat Int32 form of a multiprocessor run, laid out like BinaryResult
+struct SmpResult {
+    static constexpr int PROCESS_FIELDS = BinaryResult::PROCESS_FIELDS;
+    static constexpr int CORE_SEGMENT_FIELDS = 4;  // core, start, end, pid
+    // core, start, quantum, rounds, first, count, segment index; see
+    // CoreRounds. segments skip these stretches.
+    static constexpr int CORE_ROUND_FIELDS = 7;
+
+    std::vector<int32_t> processTable;
+    std::vector<int32_t> segments;
+    std::vector<int32_t> rounds;
+    std::vector<int32_t> roundPids;
+    std::vector<int32_t> completed;
+    double averageTurnaround = 0, averageWaiting = 0;
+    int cores = 0, makespan = 0, migrations = 0, steals = 0;
+    Metrics metrics;          // utilization and idle time over all cores
+
+    SmpResult() = default;
+
+    SmpResult(const std::vector<Process>& procs, const SmpSchedule& sched, int cores)
+        : cores(cores), makespan(sched.makespan), migrations(sched.migrations), steals(sched.steals) {
+        processTable.reserve(procs.size() * PROCESS_FIELDS);
+        for (const auto& p : procs) {
+            processTable.insert(processTable.end(),
+                { p.pid, p.arrival, p.burst, p.priority, p.start, p.end, p.turnaround, p.waiting });
+        }
+        segments.reserve(sched.segments.size() * CORE_SEGMENT_FIELDS);
+        for (const auto& s : sched.segments) {
+            segments.insert(segments.end(), { s.core, s.start, s.end, s.pid });
+        }
+        rounds.reserve(sched.rounds.size() * CORE_ROUND_FIELDS);
+        for (const auto& b : sched.rounds)
+            rounds.insert(rounds.end(), { b.core, b.start, b.quantum, b.rounds, b.first, b.count, b.segmentsAt });
+        roundPids.assign(sched.roundPids.begin(), sched.roundPids.end());
+        completed.assign(sched.completed.begin(), sched.completed.end());
+        if (!procs.empty()) {
+            averageTurnaround = sched.totalTurnaround / procs.size();
+            averageWaiting = sched.totalWaiting / procs.size();
+        }
+        metrics = sched.tally.summary(sched.makespan, sched.contextSwitches, cores);
+    }
+};
+
+using PolicyFactory = std::function<std::unique_ptr<Policy>()>;
+
+// Runs the process table on config.cores cores, each with a policy from make()
+SmpResult simulate_smp(std::vector<Process>& proc, const SmpConfig& config, const PolicyFactory& make);
+
+// -------------------- Entry points --------------------
+SmpResult fcfs_schedule_smp(const std::vector<int>& arrival, const std::vector<int>& burst, const SmpConfig& config);
+SmpResult rr_schedule_smp(const std::vector<int>& arrival, const std::vector<int>& burst, int quantum, const SmpConfig& config);
+SmpResult sjf_schedule_smp(const std::vector<int>& arrivalTimes, const std::vector<int>& burstTimes, const SmpConfig& config);
+SmpResult sjf_preemptive_schedule_smp(const std::vector<int>& arrivalTimes, const std::vector<int>& burstTimes, const SmpConfig& config);
+SmpResult priority_schedule_smp(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority, const SmpConfig& config);
+SmpResult priority_preemptive_schedule_smp(const std::vector<int>& arrival, const std::vector<int>& burst, const std::vector<int>& priority, const SmpConfig& config);
@@ -0,0 +1,46 @@
+#include "Sweep.h"
+#include "Simulator.h"
+#include <atomic>
+#include <thread>
+#include <algorithm>
+
+#if !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__)
+#define SWEEP_THREADS 1
+#endif
+
+static SweepRow summarize(int workload, int quantum, const BinaryResult& r) {
+    return { workload, quantum, r.averageTurnaround, r.averageWaiting,
+             r.metrics.averageResponse, r.metrics.contextSwitches };
+}
+
+std::vector<SweepRow> rr_sweep(const std::vector<RrWorkload>& workloads, const std::vector<int>& quanta, int threads) {
+    size_t total = workloads.size() * quanta.size();
+    std::vector<SweepRow> rows(total);
+    std::atomic<size_t> next(0);
+
+    // Each worker claims the next configuration until none are left,
+    // reusing one Simulator's buffers for all of them
+    auto worker = [&] {
+        Simulator sim("rr", 1);
+        for (size_t k = next++; k < total; k = next++) {
+            int w = k / quanta.size();
+            int q = std::max(1, quanta[k % quanta.size()]);
+            const RrWorkload& load = workloads[w];
+            sim.setPolicy("rr", q);
+            rows[k] = summarize(w, q, sim.run(columns(load.arrival, load.burst)));
+        }
+    };
+
+#ifdef SWEEP_THREADS
+    if (threads <= 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min<size_t>(threads, total);
+    std::vector<std::thread> pool;
+    for (int i = 1; i < threads; ++i) pool.emplace_back(worker);
+    worker();
+    for (auto& t : pool) t.join();
+#else
+    (void)threads;
+    worker();
+#endif
+    return rows;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+
+// Round-robin parameter sweep: every workload is run with every quantum,
+// spread over worker threads, and reduced to one summary row per run.
+
+struct RrWorkload {
+    std::vector<int> arrival;
+    std::vector<int> burst;
+};
+
+struct SweepRow {
+    int workload;                 // index into the workloads passed in
+    int quantum;
+    double averageTurnaround;
+    double averageWaiting;
+    double averageResponse;       // first run - arrival
+    int contextSwitches;          // CPU handed to a different process
+};
+
+// threads <= 0 uses every hardware thread. Builds without thread support
+// (e.g. WASM compiled without -pthread) run the configurations serially.
+std::vector<SweepRow> rr_sweep(const std::vector<RrWorkload>& workloads, const std::vector<int>& quanta, int threads = 0);
+
+// Flat form for JS: SWEEP_FIELDS doubles per row, in SweepRow field order
+struct SweepTable {
+    static constexpr int SWEEP_FIELDS = 6;
+    std::vector<double> rows;
+
+    SweepTable() = default;
+    explicit SweepTable(const std::vector<SweepRow>& table) {
+        rows.reserve(table.size() * SWEEP_FIELDS);
+        for (const auto& r : table) {
+            rows.insert(rows.end(), { double(r.workload), double(r.quantum), r.averageTurnaround,
+                                      r.averageWaiting, r.averageResponse, double(r.contextSwitches) });
+        }
+    }
+};
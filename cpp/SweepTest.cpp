@@ -0,0 +1,73 @@
+// rr_sweep: every (workload, quantum) pair once, in order, whatever the
+// number of threads the configurations are spread over
+
+#include "Tests.h"
+#include "Scheduler.h"
+#include "Sweep.h"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+static std::vector<RrWorkload> workloads(int count) {
+    std::mt19937 rng(8);
+    std::vector<RrWorkload> out(count);
+    for (auto& w : out) {
+        int n = 1 + rng() % 40;
+        for (int i = 0; i < n; ++i) {
+            w.arrival.push_back(rng() % 100);
+            w.burst.push_back(1 + rng() % 20);
+        }
+    }
+    return out;
+}
+
+static bool same(const SweepRow& a, const SweepRow& b) {
+    return a.workload == b.workload && a.quantum == b.quantum && a.averageTurnaround == b.averageTurnaround &&
+           a.averageWaiting == b.averageWaiting && a.averageResponse == b.averageResponse &&
+           a.contextSwitches == b.contextSwitches;
+}
+
+// Rows come back in (workload, quantum) order with the numbers of a plain
+// rr_schedule_binary run; quanta below 1 run as 1
+static TestCase rows("rr_sweep rows", [] {
+    std::vector<RrWorkload> loads = workloads(5);
+    std::vector<int> quanta = { 0, 1, 3, 8 };
+    std::vector<SweepRow> table = rr_sweep(loads, quanta, 1);
+    bool ok = table.size() == loads.size() * quanta.size();
+    for (size_t k = 0; ok && k < table.size(); ++k) {
+        int w = k / quanta.size(), q = std::max(1, quanta[k % quanta.size()]);
+        BinaryResult r = rr_schedule_binary(loads[w].arrival, loads[w].burst, q);
+        ok = same(table[k], { w, q, r.averageTurnaround, r.averageWaiting, r.metrics.averageResponse,
+                              r.metrics.contextSwitches });
+    }
+    check(ok, "rr_sweep rows match rr_schedule_binary in order");
+});
+
+// Any split over threads, including more threads than configurations and
+// every hardware thread (0), gives the single-threaded table
+static TestCase partitioning("rr_sweep thread partitioning", [] {
+    std::vector<RrWorkload> loads = workloads(7);
+    std::vector<int> quanta = { 1, 2, 4, 5, 9 };
+    std::vector<SweepRow> serial = rr_sweep(loads, quanta, 1);
+    for (int threads : { 0, 2, 3, 8, 64 }) {
+        std::vector<SweepRow> table = rr_sweep(loads, quanta, threads);
+        bool ok = table.size() == serial.size();
+        for (size_t k = 0; ok && k < table.size(); ++k) ok = same(table[k], serial[k]);
+        check(ok, "rr_sweep with " + std::to_string(threads) + " threads");
+    }
+    check(rr_sweep({}, quanta, 4).empty() && rr_sweep(loads, {}, 4).empty(), "rr_sweep with nothing to run");
+});
+
+// The flat table JS reads: SWEEP_FIELDS doubles per row in field order
+static TestCase flat("rr_sweep flat table", [] {
+    std::vector<SweepRow> table = rr_sweep(workloads(2), { 2, 3 }, 2);
+    SweepTable t(table);
+    bool ok = t.rows.size() == table.size() * SweepTable::SWEEP_FIELDS;
+    for (size_t k = 0; ok && k < table.size(); ++k) {
+        const double* r = &t.rows[k * SweepTable::SWEEP_FIELDS];
+        ok = r[0] == table[k].workload && r[1] == table[k].quantum && r[2] == table[k].averageTurnaround &&
+             r[3] == table[k].averageWaiting && r[4] == table[k].averageResponse && r[5] == table[k].contextSwitches;
+    }
+    check(ok, "SweepTable rows");
+});
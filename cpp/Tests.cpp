@@ -0,0 +1,458 @@
+// Native checks for the engines: every way of running a policy has to give
+// the same schedule, and the bugs fixed so far stay fixed.
+//
+//   tests [--seeds N]
+//
+// Each random workload is scheduled through the JSON and *_binary entry
+// points, their *_input variants, switch_cost_schedule with no cost,
+// Simulator and IncrementalSchedule (from scratch and after edits), and the
+// results must match; TimelineIndex must answer like the TickTables and the
+// expanded segments of the same run. Then every TestCase registered by the
+// per-engine test files runs (see Tests.h). Exits non-zero on any failure.
+
+#include "Tests.h"
+#include "Scheduler.h"
+#include "Incremental.h"
+#include "Io.h"
+#include "Simulator.h"
+#include "Smp.h"
+#include "Timeline.h"
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// -------------------- Heap accounting --------------------
+// Counts allocations so the Simulator's reuse can be checked
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+static long long allocations = 0;
+
+void* operator new(size_t size) {
+    void* p = std::malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    allocations++;
+    return p;
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+// -------------------- Checks --------------------
+static int checks = 0, failures = 0;
+
+void check(bool ok, const std::string& what) {
+    checks++;
+    if (ok) return;
+    if (++failures <= 20) std::fprintf(stderr, "FAIL %s\n", what.c_str());
+}
+
+TestCase::TestCase(const char* name, void (*run)()) : name(name), run(run) { all().push_back(this); }
+
+std::vector<const TestCase*>& TestCase::all() {
+    static std::vector<const TestCase*> cases;
+    return cases;
+}
+
+static bool same(const BinaryResult& a, const BinaryResult& b) {
+    return a.processTable == b.processTable && a.segments == b.segments && a.readyEvents == b.readyEvents &&
+           a.rounds == b.rounds && a.roundPids == b.roundPids && a.completed == b.completed &&
+           a.averageTurnaround == b.averageTurnaround && a.averageWaiting == b.averageWaiting &&
+           a.contextSwitches == b.contextSwitches;
+}
+
+// Rows of a process table sorted, for engines that list them in another order
+static std::vector<std::array<int, 8>> rows(const std::vector<int32_t>& table) {
+    std::vector<std::array<int, 8>> out;
+    for (size_t i = 0; i + 8 <= table.size(); i += 8) {
+        std::array<int, 8> r;
+        std::copy(table.begin() + i, table.begin() + i + 8, r.begin());
+        out.push_back(r);
+    }
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+// -------------------- Workloads --------------------
+struct Workload {
+    std::vector<int> arrival, burst, priority;
+    int quantum;
+
+    int size() const { return static_cast<int>(arrival.size()); }
+
+    ProcessInput input() const {
+        ProcessInput in(size());
+        in.arrival = arrival;
+        in.burst = burst;
+        in.priority = priority;
+        return in;
+    }
+};
+
+// Small tables with many ties, or longer ones with long bursts so that
+// Round Robin rounds get skipped
+static Workload generate(std::mt19937& rng) {
+    bool longRuns = rng() % 3 == 0;
+    int n = 1 + rng() % (longRuns ? 60 : 25);
+    int span = 1 + rng() % (longRuns ? 400 : 40);
+    int burst = longRuns ? 200 : 12;
+    Workload w;
+    for (int i = 0; i < n; ++i) {
+        w.arrival.push_back(rng() % span);
+        w.burst.push_back(1 + rng() % burst);
+        w.priority.push_back(rng() % 5);
+    }
+    w.quantum = 1 + rng() % 6;
+    return w;
+}
+
+struct Entry {
+    std::string name;
+    std::function<std::string(const Workload&)> json;
+    std::function<BinaryResult(const Workload&)> binary;
+    std::function<std::string(const ProcessInput&, int)> jsonInput;
+    std::function<BinaryResult(const ProcessInput&, int)> binaryInput;
+};
+
+static const std::vector<Entry>& entries() {
+    static const std::vector<Entry> all = {
+        { "fcfs", [](const Workload& w) { return fcfs_schedule(w.arrival, w.burst); },
+          [](const Workload& w) { return fcfs_schedule_binary(w.arrival, w.burst); },
+          [](const ProcessInput& in, int) { return fcfs_schedule_input(in); },
+          [](const ProcessInput& in, int) { return fcfs_schedule_binary_input(in); } },
+        { "rr", [](const Workload& w) { return rr_schedule(w.arrival, w.burst, w.quantum); },
+          [](const Workload& w) { return rr_schedule_binary(w.arrival, w.burst, w.quantum); },
+          [](const ProcessInput& in, int q) { return rr_schedule_input(in, q); },
+          [](const ProcessInput& in, int q) { return rr_schedule_binary_input(in, q); } },
+        { "sjf", [](const Workload& w) { return sjf_schedule(w.arrival, w.burst); },
+          [](const Workload& w) { return sjf_schedule_binary(w.arrival, w.burst); },
+          [](const ProcessInput& in, int) { return sjf_schedule_input(in); },
+          [](const ProcessInput& in, int) { return sjf_schedule_binary_input(in); } },
+        { "sjf-preemptive", [](const Workload& w) { return sjf_preemptive_schedule(w.arrival, w.burst); },
+          [](const Workload& w) { return sjf_preemptive_schedule_binary(w.arrival, w.burst); },
+          [](const ProcessInput& in, int) { return sjf_preemptive_schedule_input(in); },
+          [](const ProcessInput& in, int) { return sjf_preemptive_schedule_binary_input(in); } },
+        { "priority", [](const Workload& w) { return priority_schedule(w.arrival, w.burst, w.priority); },
+          [](const Workload& w) { return priority_schedule_binary(w.arrival, w.burst, w.priority); },
+          [](const ProcessInput& in, int) { return priority_schedule_input(in); },
+          [](const ProcessInput& in, int) { return priority_schedule_binary_input(in); } },
+        { "priority-preemptive",
+          [](const Workload& w) { return priority_preemptive_schedule(w.arrival, w.burst, w.priority); },
+          [](const Workload& w) { return priority_preemptive_schedule_binary(w.arrival, w.burst, w.priority); },
+          [](const ProcessInput& in, int) { return priority_preemptive_schedule_input(in); },
+          [](const ProcessInput& in, int) { return priority_preemptive_schedule_binary_input(in); } },
+    };
+    return all;
+}
+
+// -------------------- Agreement --------------------
+// Every entry point of one policy on one workload
+static void agree(const Entry& e, const Workload& w, Simulator& sim, const std::string& tag) {
+    int quantum = e.name == "rr" ? w.quantum : 0;
+    ProcessInput in = w.input();
+    BinaryResult binary = e.binary(w);
+    std::string json = e.json(w);
+
+    check(same(e.binaryInput(in, w.quantum), binary), tag + " binary_input");
+    check(e.jsonInput(in, w.quantum) == json, tag + " json_input");
+    check(same(switch_cost_schedule_binary(in, e.name, quantum, SwitchCost{}), binary), tag + " switch_cost");
+
+    sim.setPolicy(e.name, w.quantum);
+    sim.setSwitchCost(SwitchCost{});
+    check(same(sim.run(in), binary), tag + " Simulator");
+    check(sim.json() == json, tag + " Simulator json");
+
+    IncrementalSchedule inc(e.name, w.quantum);
+    inc.setProcesses(in);
+    check(same(inc.binary(), binary), tag + " IncrementalSchedule");
+    check(inc.json() == json, tag + " IncrementalSchedule json");
+
+    // Edit the latest arrivals and grow the table; the rewound run must
+    // match a fresh one
+    Workload edited = w;
+    for (int i = 0; i < edited.size(); ++i)
+        if (edited.arrival[i] * 2 >= *std::max_element(w.arrival.begin(), w.arrival.end()))
+            edited.burst[i] = edited.burst[i] % 7 + 1;
+    edited.arrival.push_back(edited.arrival.back());
+    edited.burst.push_back(3);
+    edited.priority.push_back(1);
+    inc.setProcesses(edited.input());
+    check(same(inc.binary(), e.binary(edited)), tag + " IncrementalSchedule after edits");
+}
+
+// TimelineIndex against the per-tick table, Schedule's own lookups and the
+// expanded segments of the same run
+static void timeline(const Entry& e, const Workload& w, const std::string& tag) {
+    std::vector<Process> proc = process_table(w.input().columns(), e.name.rfind("priority", 0) == 0);
+    if (e.name == "fcfs") sort_by_arrival(proc);
+    std::unique_ptr<Policy> policy = policy_by_name(e.name, proc, w.quantum);
+    Schedule sched = simulate(proc, *policy);
+
+    TimelineIndex index(sched);
+    TickTables ticks(sched);
+    std::vector<Segment> flat = sched.rounds.empty() ? sched.segments : sched.expanded().segments;
+    bool ok = true;
+    for (int t = 0; t < sched.makespan; ++t) ok = ok && index.runningAt(t) == ticks.running[t];
+    check(ok, tag + " TimelineIndex runningAt");
+
+    // Schedule::readyAt replays the log, so only some ticks are compared
+    for (int t = 0; t <= sched.makespan; t += 1 + sched.makespan / 40) {
+        std::vector<int> expect = sched.readyAt(t);
+        const std::vector<int32_t>& got = index.readyAt(t);
+        ok = ok && std::vector<int>(got.begin(), got.end()) == expect;
+    }
+    check(ok, tag + " TimelineIndex readyAt");
+
+    int span = std::max(1, sched.makespan);
+    for (int t0 = 0; t0 < span; t0 += 1 + span / 7) {
+        int t1 = t0 + 1 + span / 5;
+        std::vector<int32_t> expect;
+        for (const auto& s : flat)
+            if (s.end > t0 && s.start < t1) expect.insert(expect.end(), { s.start, s.end, s.pid });
+        check(index.segments(t0, t1) == expect, tag + " TimelineIndex window " + std::to_string(t0));
+    }
+}
+
+// -------------------- Regressions --------------------
+// FCFS lists ties by pid the same way in every entry point (the sort used
+// to differ past 16 rows)
+static void fcfsTies() {
+    Workload w;
+    for (int i = 0; i < 40; ++i) {
+        w.arrival.push_back(i % 3 == 0 ? 0 : 5);
+        w.burst.push_back(1 + i % 4);
+        w.priority.push_back(0);
+    }
+    w.quantum = 1;
+    BinaryResult r = fcfs_schedule_binary(w.arrival, w.burst);
+    bool ordered = true;
+    for (size_t i = 8; i < r.processTable.size(); i += 8) {
+        int a0 = r.processTable[i - 7], a1 = r.processTable[i + 1];
+        ordered = ordered && (a0 < a1 || (a0 == a1 && r.processTable[i - 8] < r.processTable[i]));
+    }
+    check(ordered, "fcfs ties listed by (arrival, pid)");
+    Simulator sim("fcfs", 0);
+    agree(entries()[0], w, sim, "fcfs ties");
+}
+
+// Tick-by-tick preemptive aging: the running process keeps the CPU until a
+// waiter's aged priority is strictly better than its base priority, and is
+// queued again from that tick. Among waiters the lowest aged priority wins;
+// ties go to the one queued longest, then arrival, then row.
+static std::vector<int> agingReference(const Workload& w, int step, int interval) {
+    int n = w.size(), t = 0, running = -1, left = n;
+    std::vector<int> remaining = w.burst, queuedAt = w.arrival, start(n, -1), end(n, -1);
+    std::vector<bool> done(n, false);
+    while (left) {
+        auto aged = [&](int i) { return (long long)w.priority[i] - (long long)step * ((t - queuedAt[i]) / interval); };
+        int best = -1;
+        for (int i = 0; i < n; ++i) {
+            if (done[i] || i == running || w.arrival[i] > t) continue;
+            bool better = best == -1 ? true
+                        : aged(i) != aged(best) ? aged(i) < aged(best)
+                        : queuedAt[i] != queuedAt[best] ? queuedAt[i] < queuedAt[best]
+                        : w.arrival[i] != w.arrival[best] ? w.arrival[i] < w.arrival[best]
+                        : i < best;
+            if (better) best = i;
+        }
+        if (running == -1 && best == -1) {
+            t = INT_MAX;
+            for (int i = 0; i < n; ++i)
+                if (!done[i]) t = std::min(t, w.arrival[i]);
+            continue;
+        }
+        if (running == -1 || (best != -1 && aged(best) < w.priority[running])) {
+            if (running != -1) queuedAt[running] = t;
+            running = best;
+        }
+        if (start[running] < 0) start[running] = t;
+        remaining[running]--;
+        t++;
+        if (remaining[running] == 0) {
+            done[running] = true;
+            end[running] = t;
+            running = -1;
+            left--;
+        }
+    }
+    std::vector<int> out;
+    for (int i = 0; i < n; ++i) out.insert(out.end(), { start[i], end[i] });
+    return out;
+}
+
+// Preemptive aging used to re-check only at arrivals, so a waiter aging
+// past the running process waited for the next one
+static void preemptiveAging(std::mt19937& rng, int seeds) {
+    for (int s = 0; s < seeds; ++s) {
+        Workload w;
+        int n = 1 + rng() % 20;
+        for (int i = 0; i < n; ++i) {
+            w.arrival.push_back(rng() % 50);
+            w.burst.push_back(1 + rng() % 15);
+            w.priority.push_back(rng() % 8);
+        }
+        int step = 1 + rng() % 3, interval = 1 + rng() % 6;
+        BinaryResult r = priority_aging_schedule_binary(w.arrival, w.burst, w.priority, true, step, interval);
+        std::vector<int> got;
+        for (int i = 0; i < n; ++i) got.insert(got.end(), { r.processTable[i * 8 + 4], r.processTable[i * 8 + 5] });
+        check(got == agingReference(w, step, interval), "preemptive aging seed " + std::to_string(s));
+    }
+
+    // A waiter used to take the CPU as soon as its aged priority merely tied
+    // the running one's, so equal priorities switched every tick. With
+    // aging out of reach they now run like plain preemptive priority.
+    for (int s = 0; s < seeds; ++s) {
+        Workload w;
+        int n = 1 + rng() % 20, level = rng() % 5;
+        for (int i = 0; i < n; ++i) {
+            w.arrival.push_back(rng() % 50);
+            w.burst.push_back(1 + rng() % 15);
+            w.priority.push_back(level);
+        }
+        BinaryResult aging = priority_aging_schedule_binary(w.arrival, w.burst, w.priority, true, 1, 1000000);
+        BinaryResult plain = priority_preemptive_schedule_binary(w.arrival, w.burst, w.priority);
+        check(aging.processTable == plain.processTable && aging.segments == plain.segments &&
+                  aging.contextSwitches == plain.contextSwitches,
+              "equal priorities without aging seed " + std::to_string(s));
+    }
+    BinaryResult two = priority_aging_schedule_binary({ 0, 0 }, { 5, 5 }, { 3, 3 }, true, 1, 1000000);
+    check(two.contextSwitches == 1, "equal priorities switch once");
+}
+
+// CPU/I-O runs share simulate()'s loop: one CPU burst per process is the
+// plain schedule, switch cost included
+static void ioMatchesSingleCpu(std::mt19937& rng, int seeds) {
+    for (int s = 0; s < seeds; ++s) {
+        Workload w = generate(rng);
+        int n = w.size();
+        BurstInput in(n, n);
+        for (int i = 0; i < n; ++i) {
+            in.arrival[i] = w.arrival[i];
+            in.priority[i] = w.priority[i];
+            in.first[i + 1] = i + 1;
+            in.length[i] = w.burst[i];
+            in.device[i] = BurstInput::CPU;
+        }
+        SwitchCost cost{ int(rng() % 3), int(rng() % 4), 1 + int(rng() % 4) };
+        if (s % 2) cost = SwitchCost{};
+        for (const auto& e : entries()) {
+            if (e.name == "fcfs") continue;   // FCFS lists its table by arrival
+            IoResult io = io_schedule(in, e.name, w.quantum, cost);
+            BinaryResult plain = switch_cost_schedule_binary(w.input(), e.name, w.quantum, cost);
+            // The plain table zeroes priorities for policies that ignore them
+            for (size_t j = 3; j < io.processTable.size(); j += 8) io.processTable[j] = plain.processTable[j];
+            check(io.processTable == plain.processTable && io.segments == plain.segments && io.rounds == plain.rounds &&
+                      io.metrics.switchOverhead == plain.metrics.switchOverhead,
+                  "io " + e.name + " seed " + std::to_string(s));
+        }
+    }
+}
+
+// One core is the single-CPU schedule; on several, Round Robin's skipped
+// rounds still give every process exactly its burst, one slice at a time
+static void smpRounds(std::mt19937& rng, int seeds) {
+    for (int s = 0; s < seeds; ++s) {
+        Workload w = generate(rng);
+        SmpConfig one;
+        check(rows(rr_schedule_smp(w.arrival, w.burst, w.quantum, one).processTable) ==
+                  rows(rr_schedule_binary(w.arrival, w.burst, w.quantum).processTable),
+              "smp one core rr seed " + std::to_string(s));
+
+        SmpConfig many;
+        many.cores = 2 + rng() % 4;
+        many.steal = rng() % 2;
+        SmpResult r = rr_schedule_smp(w.arrival, w.burst, w.quantum, many);
+        std::vector<long long> ran(w.size() + 1, 0);
+        std::vector<int> lastEnd(many.cores, 0);
+        bool ok = true;
+        auto slice = [&](int core, int start, int end, int pid) {
+            ok = ok && start >= lastEnd[core] && end > start;
+            lastEnd[core] = end;
+            ran[pid] += end - start;
+        };
+        size_t b = 0;
+        for (size_t i = 0; i <= r.segments.size(); i += SmpResult::CORE_SEGMENT_FIELDS) {
+            for (; b < r.rounds.size() && size_t(r.rounds[b + 6]) * SmpResult::CORE_SEGMENT_FIELDS == i;
+                 b += SmpResult::CORE_ROUND_FIELDS) {
+                int t = r.rounds[b + 1], q = r.rounds[b + 2];
+                for (int k = 0; k < r.rounds[b + 3]; ++k)
+                    for (int j = 0; j < r.rounds[b + 5]; ++j, t += q) slice(r.rounds[b], t, t + q, r.roundPids[r.rounds[b + 4] + j]);
+            }
+            if (i < r.segments.size()) slice(r.segments[i], r.segments[i + 1], r.segments[i + 2], r.segments[i + 3]);
+        }
+        for (int i = 0; i < w.size(); ++i) ok = ok && ran[i + 1] == w.burst[i];
+        check(ok, "smp rr rounds seed " + std::to_string(s));
+    }
+}
+
+// The Simulator keeps one queue per policy name: a quantum sweep gives the
+// entry point's results and stops allocating once warm
+static void simulatorQuanta(std::mt19937& rng) {
+    Workload w;
+    for (int i = 0; i < 2000; ++i) {
+        w.arrival.push_back(rng() % 20000);
+        w.burst.push_back(1 + rng() % 40);
+        w.priority.push_back(rng() % 5);
+    }
+    ProcessInput in = w.input();
+    Simulator sim("rr", 1);
+    bool ok = true;
+    for (int q = 1; q <= 50; ++q) {
+        sim.setPolicy("rr", q);
+        ok = ok && same(sim.run(in), rr_schedule_binary(w.arrival, w.burst, q));
+    }
+    check(ok, "Simulator quantum sweep matches rr_schedule_binary");
+
+    // The first sweep sizes the buffers; the second reuses them
+    auto sweep = [&] {
+        for (int q = 1; q <= 200; ++q) {
+            sim.setPolicy(q % 2 ? "rr" : "sjf", q);
+            sim.run(in);
+        }
+    };
+    sweep();
+    long long before = allocations;
+    sweep();
+    bool reused = allocations == before;   // before check() builds its message
+    check(reused, "Simulator quantum sweep allocates nothing once warm");
+}
+
+int main(int argc, char** argv) {
+    int seeds = 300;
+    for (int i = 1; i + 1 < argc; i += 2)
+        if (std::string(argv[i]) == "--seeds") seeds = std::atoi(argv[i + 1]);
+
+    std::mt19937 rng(1);
+    Simulator sim("fcfs", 0);
+    for (int s = 0; s < seeds; ++s) {
+        Workload w = generate(rng);
+        for (const auto& e : entries()) {
+            std::string tag = e.name + " seed " + std::to_string(s);
+            agree(e, w, sim, tag);
+            timeline(e, w, tag);
+        }
+    }
+
+    fcfsTies();
+    preemptiveAging(rng, seeds * 5);
+    ioMatchesSingleCpu(rng, seeds);
+    smpRounds(rng, seeds);
+    simulatorQuanta(rng);
+
+    for (const TestCase* c : TestCase::all()) {
+        int before = failures;
+        c->run();
+        if (failures > before) std::fprintf(stderr, "FAIL in %s\n", c->name);
+    }
+
+    std::printf("%d checks, %d failures\n", checks, failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Shared by the test binary's files (see Tests.cpp). Each engine's tests
+// live in a file of their own and register with a static TestCase:
+//
+//   static TestCase mlfq("mlfq levels", [] { check(..., "what failed"); });
+//
+// main() runs every registered case after the cross-entry-point checks.
+
+// Records one check; failures are printed with `what` and fail the run
+void check(bool ok, const std::string& what);
+
+struct TestCase {
+    const char* name;
+    void (*run)();
+
+    TestCase(const char* name, void (*run)());
+
+    static std::vector<const TestCase*>& all();
+};
@@ -0,0 +1,318 @@
+#include "Timeline.h"
+#include <algorithm>
+#include <numeric>
+#include <climits>
+
+TimelineIndex::TimelineIndex(const Schedule& sched)
+    : order(sched.readyOrder()), rounds(sched.rounds), roundPids(sched.roundPids), span(sched.makespan) {
+    pieces.reserve(sched.segments.size() + rounds.size());
+    size_t next = 0;
+    for (size_t i = 0; i < rounds.size(); ++i) {
+        for (; next < size_t(rounds[i].segmentsAt); ++next) {
+            const Segment& s = sched.segments[next];
+            pieces.push_back({ s.start, s.end, s.pid, -1 });
+        }
+        pieces.push_back({ rounds[i].start, rounds[i].end(), -1, static_cast<int>(i) });
+    }
+    for (; next < sched.segments.size(); ++next) {
+        const Segment& s = sched.segments[next];
+        pieces.push_back({ s.start, s.end, s.pid, -1 });
+    }
+
+    std::vector<int> open;
+    for (const auto& e : sched.readyEvents) {
+        if (e.pid >= static_cast<int>(open.size())) open.resize(e.pid + 1, -1);
+        if (e.enter) {
+            open[e.pid] = stays.size();
+            stays.push_back({ e.time, INT_MAX, e.pid });
+        } else if (open[e.pid] != -1) {
+            stays[open[e.pid]].end = e.time;
+            open[e.pid] = -1;
+        }
+    }
+    // A stay that ends when it starts is never seen at any tick
+    stays.erase(std::remove_if(stays.begin(), stays.end(), [](const Stay& s) { return s.start >= s.end; }),
+                stays.end());
+
+    std::vector<int> items(stays.size());
+    std::iota(items.begin(), items.end(), 0);
+    root = build(items);
+}
+
+int TimelineIndex::build(std::vector<int>& items) {
+    if (items.empty()) return -1;
+
+    // The median start as center leaves at most half the stays on each side,
+    // and the stay it came from always stays at this node
+    auto mid = items.begin() + items.size() / 2;
+    std::nth_element(items.begin(), mid, items.end(),
+                     [&](int a, int b) { return stays[a].start < stays[b].start; });
+    int center = stays[*mid].start;
+
+    std::vector<int> left, right, here;
+    for (int i : items) {
+        if (stays[i].end <= center) left.push_back(i);
+        else if (stays[i].start > center) right.push_back(i);
+        else here.push_back(i);
+    }
+
+    int id = nodes.size();
+    nodes.push_back({ center, -1, -1, static_cast<int>(byStart.size()), static_cast<int>(here.size()) });
+    std::sort(here.begin(), here.end(), [&](int a, int b) { return stays[a].start < stays[b].start; });
+    byStart.insert(byStart.end(), here.begin(), here.end());
+    std::sort(here.begin(), here.end(), [&](int a, int b) { return stays[a].end > stays[b].end; });
+    byEnd.insert(byEnd.end(), here.begin(), here.end());
+
+    int l = build(left);
+    int r = build(right);
+    nodes[id].left = l;
+    nodes[id].right = r;
+    return id;
+}
+
+const TimelineIndex::Piece* TimelineIndex::pieceAt(int t) const {
+    auto it = std::upper_bound(pieces.begin(), pieces.end(), t,
+        [](int time, const Piece& p) { return time < p.start; });
+    if (it == pieces.begin() || t >= (--it)->end) return nullptr;
+    return &*it;
+}
+
+// First and last stretch of a piece on one pid. A block of one process is
+// that process throughout; otherwise every slice changes pid.
+Segment TimelineIndex::head(const Piece& p) const {
+    if (p.block < 0) return { p.start, p.end, p.pid };
+    const RoundBlock& b = rounds[p.block];
+    if (b.count == 1) return { p.start, p.end, roundPids[b.first] };
+    return { p.start, p.start + b.quantum, roundPids[b.first] };
+}
+
+Segment TimelineIndex::tail(const Piece& p) const {
+    if (p.block < 0) return { p.start, p.end, p.pid };
+    const RoundBlock& b = rounds[p.block];
+    if (b.count == 1) return { p.start, p.end, roundPids[b.first] };
+    return { p.end - b.quantum, p.end, roundPids[b.first + b.count - 1] };
+}
+
+// Appends a segment, merged into the previous one like Schedule::run does
+void TimelineIndex::emit(int start, int finish, int pid) {
+    size_t n = out.size();
+    if (n && pid != SWITCH_PID && out[n - 1] == pid && out[n - 2] == start) {
+        out[n - 2] = finish;
+        return;
+    }
+    out.insert(out.end(), { start, finish, pid });
+}
+
+const std::vector<int32_t>& TimelineIndex::segments(int t0, int t1) {
+    out.clear();
+    if (t0 >= t1) return out;
+
+    // Pieces are disjoint and in time order, so their ends are sorted too
+    auto first = std::partition_point(pieces.begin(), pieces.end(), [&](const Piece& p) { return p.end <= t0; });
+    auto it = first;
+    for (; it != pieces.end() && it->start < t1; ++it) {
+        if (it->block < 0 || rounds[it->block].count == 1) {
+            Segment s = head(*it);
+            emit(s.start, s.end, s.pid);
+            continue;
+        }
+        const RoundBlock& b = rounds[it->block];
+        int q = b.quantum;
+        int from = std::max(0, (t0 - b.start) / q);
+        int to = (std::min(b.end(), t1) - b.start + q - 1) / q;
+        for (int k = from; k < to; ++k)
+            emit(b.start + k * q, b.start + (k + 1) * q, roundPids[b.first + k % b.count]);
+    }
+    if (out.empty()) return out;
+
+    // The loop merges back-to-back runs of one pid across pieces, so the
+    // first and last segments can reach beyond the pieces read so far
+    for (auto j = first; j != pieces.begin();) {
+        Segment s = tail(*--j);
+        if (s.pid == SWITCH_PID || s.pid != out[2] || s.end != out[0]) break;
+        out[0] = s.start;
+        if (s.start != j->start) break;
+    }
+    for (auto j = it; j != pieces.end(); ++j) {
+        Segment s = head(*j);
+        size_t n = out.size();
+        if (s.pid == SWITCH_PID || s.pid != out[n - 1] || s.start != out[n - 2]) break;
+        out[n - 2] = s.end;
+        if (s.end != j->end) break;
+    }
+    return out;
+}
+
+int TimelineIndex::runningAt(int t) const {
+    const Piece* p = pieceAt(t);
+    if (!p) return -1;
+    if (p->block < 0) return p->pid;
+    const RoundBlock& b = rounds[p->block];
+    return roundPids[b.first + (t - b.start) / b.quantum % b.count];
+}
+
+const std::vector<int32_t>& TimelineIndex::readyAt(int t) {
+    out.clear();
+    const Piece* p = pieceAt(t);
+    if (p && p->block >= 0) {
+        // Within whole rounds the queue is the block's pids, rotated to
+        // follow the one on the CPU
+        const RoundBlock& b = rounds[p->block];
+        int j = (t - b.start) / b.quantum;
+        for (int k = 1; k < b.count; ++k) out.push_back(roundPids[b.first + (j + k) % b.count]);
+    } else {
+        found.clear();
+        for (int n = root; n != -1;) {
+            const Node& node = nodes[n];
+            int to = node.from + node.count;
+            if (t < node.center) {
+                for (int i = node.from; i < to && stays[byStart[i]].start <= t; ++i) found.push_back(byStart[i]);
+                n = node.left;
+            } else {
+                for (int i = node.from; i < to && stays[byEnd[i]].end > t; ++i) found.push_back(byEnd[i]);
+                n = node.right;
+            }
+        }
+        std::sort(found.begin(), found.end());
+        for (int i : found) out.push_back(stays[i].pid);
+    }
+    if (order == ReadyOrder::ByPid) std::sort(out.begin(), out.end());
+    return out;
+}
+
+// Fills `count` buckets of `width` ticks from `from` by walking the pieces
+// once in time order
+void TimelineIndex::accumulate(int from, int width, int count, std::vector<Bucket>& buckets) {
+    buckets.assign(count, {});
+    long long to = from + (long long)width * count;
+    int cur = -1;
+    auto flush = [&] {
+        if (cur < 0) return;
+        Bucket& b = buckets[cur];
+        for (const auto& [pid, ticks] : share)
+            if (ticks > b.ticks || (ticks == b.ticks && pid < b.pid)) b.pid = pid, b.ticks = ticks;
+        share.clear();
+    };
+    auto credit = [&](int bucket, int pid, int ticks) {
+        if (bucket != cur) {
+            flush();
+            cur = bucket;
+        }
+        share[pid] += ticks;
+    };
+
+    // Process that had the CPU last, for counting switches like Schedule
+    int lastPid = -1;
+    auto first = std::partition_point(pieces.begin(), pieces.end(), [&](const Piece& p) { return p.end <= from; });
+    for (auto j = first; j != pieces.begin();) {
+        Segment s = tail(*--j);
+        if (s.pid != SWITCH_PID) {
+            lastPid = s.pid;
+            break;
+        }
+    }
+
+    // One pid on the CPU over [s, e); time switching is neither busy nor a switch
+    auto stretch = [&](long long s, long long e, int pid) {
+        if (pid == SWITCH_PID) return;
+        if (s >= from && lastPid != -1 && pid != lastPid) buckets[(s - from) / width].switches++;
+        lastPid = pid;
+        for (long long x = std::max<long long>(s, from), z = std::min(e, to); x < z;) {
+            int b = (x - from) / width;
+            long long next = std::min(z, from + (long long)(b + 1) * width);
+            credit(b, pid, next - x);
+            buckets[b].busy += next - x;
+            x = next;
+        }
+    };
+
+    for (auto it = first; it != pieces.end() && it->start < to; ++it) {
+        if (it->block < 0 || rounds[it->block].count == 1) {
+            Segment s = head(*it);
+            stretch(it->start, it->end, s.pid);
+            continue;
+        }
+        const RoundBlock& r = rounds[it->block];
+        const int* pids = &roundPids[r.first];
+        long long q = r.quantum, a = std::max<long long>(r.start, from), z = std::min<long long>(r.end(), to);
+        auto sliceAt = [&](long long t) { return pids[(t - r.start) / q % r.count]; };
+        if (a > r.start) lastPid = sliceAt(a - 1);
+
+        if (q >= width) {
+            for (long long k = (a - r.start) / q; r.start + k * q < z; ++k)
+                stretch(r.start + k * q, r.start + (k + 1) * q, pids[k % r.count]);
+            continue;
+        }
+        // Several slices per bucket: count the slice starts, and credit the
+        // one in the middle with an even share of the stretch
+        for (long long x = a; x < z;) {
+            int b = (x - from) / width;
+            long long next = std::min(z, from + (long long)(b + 1) * width);
+            long long k0 = (x - r.start + q - 1) / q, k1 = (next - r.start + q - 1) / q;
+            int starts = k1 - k0;
+            if (k0 == 0 && starts > 0 && (lastPid == -1 || lastPid == pids[0])) starts--;
+            buckets[b].switches += starts;
+            long long slices = (next - 1 - r.start) / q - (x - r.start) / q + 1;
+            int ticks = next - x;
+            credit(b, sliceAt((x + next) / 2), ticks / std::min<long long>(slices, r.count));
+            buckets[b].busy += ticks;
+            x = next;
+        }
+        lastPid = sliceAt(z - 1);
+    }
+    flush();
+}
+
+const std::vector<int32_t>& TimelineIndex::overview(int t0, int t1, int pixels) {
+    out.clear();
+    t0 = std::max(t0, 0);
+    t1 = std::min(t1, span);
+    if (t0 >= t1 || pixels <= 0) return out;
+
+    if (pyramid.empty()) {
+        base = (span + (long long)LOD_BUCKETS - 1) / LOD_BUCKETS;
+        pyramid.emplace_back();
+        accumulate(0, base, (span + (long long)base - 1) / base, pyramid[0]);
+        while (pyramid.back().size() > 1) {
+            const std::vector<Bucket>& below = pyramid.back();
+            std::vector<Bucket> up((below.size() + 1) / 2);
+            for (size_t i = 0; i < up.size(); ++i) {
+                Bucket m = below[2 * i];
+                if (2 * i + 1 < below.size()) {
+                    const Bucket& b = below[2 * i + 1];
+                    m.switches += b.switches;
+                    m.busy += b.busy;
+                    if (b.ticks > m.ticks) m.pid = b.pid, m.ticks = b.ticks;
+                }
+                up[i] = m;
+            }
+            pyramid.push_back(std::move(up));
+        }
+    }
+
+    auto put = [&](long long s, long long e, const Bucket& b) {
+        out.insert(out.end(), { int32_t(s), int32_t(std::min<long long>(e, span)), b.pid, b.switches, b.busy });
+    };
+
+    long long want = ((long long)t1 - t0 + pixels - 1) / pixels;
+    if (want < base) {
+        int count = ((long long)t1 - t0 + want - 1) / want;
+        accumulate(t0, want, count, fine);
+        for (int i = 0; i < count; ++i) put(t0 + i * want, t0 + (i + 1) * want, fine[i]);
+        return out;
+    }
+
+    // Coarsest level still at least as fine as asked for, then coarser
+    // while the window's buckets do not fit
+    size_t level = 0;
+    while (level + 1 < pyramid.size() && ((long long)base << (level + 1)) <= want) level++;
+    auto buckets = [&](size_t l) {
+        long long w = (long long)base << l;
+        return (t1 - 1) / w - t0 / w + 1;
+    };
+    while (level + 1 < pyramid.size() && buckets(level) > pixels) level++;
+
+    long long w = (long long)base << level;
+    for (long long i = t0 / w; i <= (t1 - 1) / w; ++i) put(i * w, (i + 1) * w, pyramid[level][i]);
+    return out;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Scheduler.h"
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+// Time-window queries over a finished run, for views that only show part of
+// it at a time. Built once from a Schedule, RoundBlocks included without
+// expanding them; each query then costs O(log n + k) for k records found
+// (plus sorting the k ready pids). Results go into one buffer owned by the
+// index, which the next query overwrites.
+class TimelineIndex {
+public:
+    static constexpr int SEGMENT_FIELDS = BinaryResult::SEGMENT_FIELDS;
+
+    TimelineIndex() = default;
+    explicit TimelineIndex(const Schedule& sched);
+
+    int makespan() const { return span; }
+
+    // Segments overlapping [t0, t1), SEGMENT_FIELDS ints each in time order,
+    // not clipped to the window. Round Robin rounds are listed slice by slice
+    // like Schedule::expanded() records them.
+    const std::vector<int32_t>& segments(int t0, int t1);
+
+    // Same answers as Schedule::runningAt / readyAt
+    int runningAt(int t) const;
+    const std::vector<int32_t>& readyAt(int t);
+
+    // start, end, dominant pid (-1 when idle), context switches, busy ticks;
+    // the busy fraction is busy / (end - start)
+    static constexpr int OVERVIEW_FIELDS = 5;
+    // Buckets at the finest level of the pyramid
+    static constexpr int LOD_BUCKETS = 1 << 16;
+
+    // [t0, t1) summarized in at most `pixels` buckets for drawing. Buckets
+    // come from a pyramid built on first use, each level half as fine as
+    // the one below, so a query costs O(pixels) however many segments the
+    // window holds. Windows narrower than the finest level are summarized
+    // from their segments directly. Switch and busy counts are exact. The
+    // dominant pid is the one with the most CPU time in the bucket, except
+    // above the finest level, where it is the heavier of the two halves'
+    // dominant pids, and in Round Robin rounds finer than a bucket, where
+    // it is the process on the CPU at the middle of the stretch.
+    const std::vector<int32_t>& overview(int t0, int t1, int pixels);
+
+private:
+    // Stay of one pid in the ready set, [start, end). Stays are kept in the
+    // order they began, which is also the queue order.
+    struct Stay {
+        int start, end, pid;
+    };
+    // Centered interval tree node: every stay with start <= center < end,
+    // as a range of byStart (ascending start) and byEnd (descending end)
+    struct Node {
+        int center;
+        int left = -1, right = -1;
+        int from, count;
+    };
+
+    // A flat segment, or a whole RoundBlock (block >= 0), in time order
+    struct Piece {
+        int start, end, pid, block;
+    };
+
+    struct Bucket {
+        int pid = -1, ticks = 0;   // dominant pid and its CPU time
+        int switches = 0, busy = 0;
+    };
+
+    int build(std::vector<int>& items);
+    void accumulate(int from, int width, int count, std::vector<Bucket>& buckets);
+    const Piece* pieceAt(int t) const;
+    Segment head(const Piece& p) const;
+    Segment tail(const Piece& p) const;
+    void emit(int start, int finish, int pid);
+
+    ReadyOrder order = ReadyOrder::Fifo;
+    std::vector<Piece> pieces;
+    std::vector<RoundBlock> rounds;
+    std::vector<int> roundPids;
+    std::vector<Stay> stays;
+    std::vector<Node> nodes;
+    std::vector<int> byStart, byEnd;
+    int root = -1;
+    int span = 0;
+    std::vector<std::vector<Bucket>> pyramid;   // level l buckets are base << l ticks wide
+    int base = 0;
+    std::vector<Bucket> fine;
+    std::unordered_map<int, int> share;         // CPU time per pid in the bucket being filled
+    std::vector<int> found;
+    std::vector<int32_t> out;
+};
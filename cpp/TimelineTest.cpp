@@ -0,0 +1,125 @@
+// TimelineIndex::overview against a tick-by-tick count of the same run:
+// busy time and switches are exact at every level, the dominant pid where
+// buckets are counted directly
+
+#include "Tests.h"
+#include "Scheduler.h"
+#include "Timeline.h"
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+// Who holds the CPU at each tick (-1 idle, SWITCH_PID switching) and where
+// a context switch starts, counted like Schedule: a pid other than the last
+// one that ran, idle gaps and switch time in between
+struct Ticks {
+    std::vector<int> owner;
+    std::vector<int> switchAt;
+
+    explicit Ticks(const Schedule& sched) : owner(sched.makespan, -1), switchAt(sched.makespan, 0) {
+        int last = -1;
+        for (const Segment& s : sched.rounds.empty() ? sched.segments : sched.expanded().segments) {
+            std::fill(owner.begin() + s.start, owner.begin() + s.end, s.pid);
+            if (s.pid == SWITCH_PID) continue;
+            if (last != -1 && s.pid != last) switchAt[s.start]++;
+            last = s.pid;
+        }
+    }
+
+    int busy(int s, int e) const {
+        int n = 0;
+        for (int t = s; t < e; ++t) n += owner[t] > 0;
+        return n;
+    }
+    int switches(int s, int e) const {
+        int n = 0;
+        for (int t = s; t < e; ++t) n += switchAt[t];
+        return n;
+    }
+    // Most CPU time in [s, e), ties to the lower pid; -1 when nothing ran
+    int dominant(int s, int e) const {
+        std::map<int, int> share;
+        for (int t = s; t < e; ++t)
+            if (owner[t] > 0) share[owner[t]]++;
+        int best = -1, most = 0;
+        for (auto [pid, ticks] : share)
+            if (ticks > most) best = pid, most = ticks;
+        return best;
+    }
+};
+
+static Schedule run(const std::string& policy, const std::vector<int>& arrival, const std::vector<int>& burst, int quantum,
+                    const SwitchCost& cost = {}) {
+    ProcessInput in(arrival.size());
+    in.arrival = arrival;
+    in.burst = burst;
+    std::vector<Process> proc = process_table(in.columns(), false);
+    std::unique_ptr<Policy> p = policy_by_name(policy, proc, quantum);
+    return simulate(proc, *p, cost);
+}
+
+// Buckets cover the window in order, at most `pixels` of them, each with
+// the busy time and switches of its whole span
+static bool consistent(TimelineIndex& index, const Ticks& ticks, int t0, int t1, int pixels, bool exactPid) {
+    const std::vector<int32_t>& out = index.overview(t0, t1, pixels);
+    int f = TimelineIndex::OVERVIEW_FIELDS, count = out.size() / f;
+    if (count == 0 || count > pixels || out[0] > t0 || out[(count - 1) * f + 1] < std::min(t1, index.makespan()))
+        return false;
+    for (int i = 0; i < count; ++i) {
+        const int32_t* b = &out[i * f];
+        if (i > 0 && b[0] != b[1 - f]) return false;
+        if (b[4] != ticks.busy(b[0], b[1]) || b[3] != ticks.switches(b[0], b[1])) return false;
+        if (exactPid && b[2] != ticks.dominant(b[0], b[1])) return false;
+    }
+    return true;
+}
+
+// Short runs: the pyramid is one bucket per tick at the bottom, so per-tick
+// buckets name the process on the CPU, and coarser ones still count busy
+// time and switches exactly
+static TestCase shortRuns("overview short runs", [] {
+    std::mt19937 rng(23);
+    bool ok = true;
+    for (int s = 0; s < 60 && ok; ++s) {
+        int n = 1 + rng() % 12;
+        std::vector<int> arrival, burst;
+        for (int i = 0; i < n; ++i) {
+            arrival.push_back(rng() % 60);
+            burst.push_back(1 + rng() % 15);
+        }
+        SwitchCost cost;
+        cost.fixed = s % 3 == 0 ? 1 : 0;
+        for (const char* policy : { "fcfs", "rr", "sjf-preemptive" }) {
+            Schedule sched = run(policy, arrival, burst, 1 + s % 4, cost);
+            TimelineIndex index(sched);
+            Ticks ticks(sched);
+            int span = sched.makespan;
+            ok = ok && consistent(index, ticks, 0, span, span, true);
+            for (int pixels : { 1, 3, 16 }) ok = ok && consistent(index, ticks, 0, span, pixels, false);
+            int t0 = rng() % span, t1 = t0 + 1 + rng() % (span - t0);
+            ok = ok && consistent(index, ticks, t0, t1, 1 + rng() % 20, false);
+        }
+    }
+    check(ok, "overview buckets of short runs");
+});
+
+// A run past LOD_BUCKETS ticks, mostly skipped Round Robin rounds: windows
+// narrower than the finest level are counted directly, pid included, and
+// wide ones come from the pyramid
+static TestCase longRuns("overview long runs", [] {
+    Schedule sched = run("rr", { 0, 0, 5, 40000 }, { 300000, 250000, 7, 200000 }, 7);
+    check(!sched.rounds.empty() && sched.makespan > TimelineIndex::LOD_BUCKETS, "overview long run has rounds");
+    TimelineIndex index(sched);
+    Ticks ticks(sched);
+    int span = sched.makespan;
+    check(consistent(index, ticks, 123457, 123957, 100, true), "overview narrow window counted directly");
+    check(consistent(index, ticks, 39990, 40090, 50, true), "overview narrow window across an arrival");
+    check(consistent(index, ticks, 0, span, 1000, false), "overview whole run from the pyramid");
+    check(consistent(index, ticks, span / 3, span / 2, 7, false), "overview coarse window from the pyramid");
+
+    const std::vector<int32_t>& all = index.overview(0, span, 1);
+    check(all.size() == size_t(TimelineIndex::OVERVIEW_FIELDS) && all[4] == span && all[3] == ticks.switches(0, span),
+          "overview top bucket sums the run");
+});
@@ -0,0 +1,406 @@
+#include "Trace.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+
+// One scheduler event, whichever format it came from
+struct TraceEvent {
+    long long time = 0;   // ns
+    bool wakeup = false;  // otherwise a switch
+    int pid = 0;          // task woken, or switched out
+    int next = 0;         // task switched in
+    int prio = 120, nextPrio = 120;
+    char state = 'R';     // state the switched-out task is left in
+};
+
+constexpr char MAGIC[8] = { 'S', 'C', 'H', 'E', 'D', 'T', 'R', '1' };
+constexpr size_t RECORD = 24;
+constexpr size_t WINDOW = size_t(64) << 20;
+
+struct File {
+    int fd;
+    ~File() { close(fd); }
+};
+
+struct Mapping {
+    void* data;
+    size_t len;
+    ~Mapping() { munmap(data, len); }
+};
+
+}  // namespace
+
+// Maps the file WINDOW bytes at a time and calls f(data, len, last) on each
+// window; f returns how many bytes it used, and the rest is mapped again at
+// the start of the next window. Each window is unmapped once parsed.
+template <typename F>
+static void for_each_window(const std::string& path, F&& f) {
+    File file{ open(path.c_str(), O_RDONLY) };
+    if (file.fd < 0) throw std::runtime_error(path + ": cannot open");
+    struct stat st;
+    if (fstat(file.fd, &st) != 0) throw std::runtime_error(path + ": cannot stat");
+    size_t size = st.st_size, page = sysconf(_SC_PAGESIZE);
+
+    for (size_t off = 0; off < size;) {
+        size_t base = off - off % page, len = std::min(WINDOW, size - off);
+        void* data = mmap(nullptr, len + (off - base), PROT_READ, MAP_PRIVATE, file.fd, base);
+        if (data == MAP_FAILED) throw std::runtime_error(path + ": cannot map");
+        Mapping map{ data, len + (off - base) };
+        madvise(map.data, map.len, MADV_SEQUENTIAL);
+
+        bool last = off + len == size;
+        size_t used = f(static_cast<const char*>(data) + (off - base), len, last);
+        if (last) break;
+        if (used == 0) throw std::runtime_error(path + ": line longer than the mapping window");
+        off += used;
+    }
+}
+
+static bool parse_int(std::string_view s, int& out) {
+    auto [end, ec] = std::from_chars(s.data(), s.data() + s.size(), out);
+    return ec == std::errc() && end != s.data();
+}
+
+// "1234.567890" seconds to ns
+static bool parse_time(std::string_view s, long long& ns) {
+    size_t dot = s.find('.');
+    long long sec = 0;
+    auto [end, ec] = std::from_chars(s.data(), s.data() + std::min(dot, s.size()), sec);
+    if (ec != std::errc() || end == s.data()) return false;
+    long long frac = 0, scale = 1000000000;
+    if (dot != std::string_view::npos) {
+        for (size_t i = dot + 1; i < s.size() && scale > 1; ++i) {
+            scale /= 10;
+            frac += (s[i] - '0') * scale;
+        }
+    }
+    ns = sec * 1000000000 + frac;
+    return true;
+}
+
+// Integer after " key=" in s
+static bool field(std::string_view s, std::string_view key, int& out) {
+    size_t at = s.find(key);
+    return at != std::string_view::npos && parse_int(s.substr(at + key.size()), out);
+}
+
+// "comm:pid [prio]" ending s; comm may itself hold ':' or spaces
+static bool compact_task(std::string_view s, int& pid, int& prio) {
+    size_t open = s.rfind(" [");
+    if (open == std::string_view::npos || !parse_int(s.substr(open + 2), prio)) return false;
+    size_t colon = s.rfind(':', open);
+    return colon != std::string_view::npos && parse_int(s.substr(colon + 1, open - colon - 1), pid);
+}
+
+// One line of perf sched script or ftrace output; false for anything but a
+// switch or wakeup
+static bool parse_line(std::string_view line, TraceEvent& e) {
+    static constexpr std::string_view NAMES[] = { "sched_switch:", "sched_wakeup:", "sched_wakeup_new:" };
+    size_t at = std::string_view::npos;
+    std::string_view name;
+    for (std::string_view n : NAMES) {
+        if ((at = line.find(n)) != std::string_view::npos) {
+            name = n;
+            break;
+        }
+    }
+    if (at == std::string_view::npos) return false;
+    e.wakeup = name != NAMES[0];
+
+    // The timestamp is the "secs.frac:" token before the event name
+    size_t j = at;
+    if (j >= 6 && line.substr(j - 6, 6) == "sched:") j -= 6;
+    while (j > 0 && line[j - 1] == ' ') j--;
+    if (j == 0 || line[j - 1] != ':') return false;
+    size_t end = --j;
+    while (j > 0 && (std::isdigit(static_cast<unsigned char>(line[j - 1])) || line[j - 1] == '.')) j--;
+    if (!parse_time(line.substr(j, end - j), e.time)) return false;
+
+    std::string_view rest = line.substr(at + name.size());
+    if (e.wakeup) {
+        if (rest.find(" pid=") != std::string_view::npos) {
+            field(rest, " prio=", e.prio);
+            return field(rest, " pid=", e.pid);
+        }
+        return compact_task(rest.substr(0, rest.find(']') + 1), e.pid, e.prio);
+    }
+
+    if (rest.find(" prev_pid=") != std::string_view::npos) {
+        size_t state = rest.find(" prev_state=");
+        if (state != std::string_view::npos && state + 12 < rest.size()) e.state = rest[state + 12];
+        field(rest, " prev_prio=", e.prio);
+        field(rest, " next_prio=", e.nextPrio);
+        return field(rest, " prev_pid=", e.pid) && field(rest, " next_pid=", e.next);
+    }
+    size_t arrow = rest.find(" ==> ");
+    if (arrow == std::string_view::npos) return false;
+    std::string_view left = rest.substr(0, arrow);
+    size_t space = left.find_last_of(' ');
+    if (space == std::string_view::npos || space + 1 >= left.size()) return false;
+    e.state = left[space + 1];
+    return compact_task(left.substr(0, space), e.pid, e.prio) &&
+           compact_task(rest.substr(arrow + 4), e.next, e.nextPrio);
+}
+
+// time (int64), pid, next (int32), prio, nextPrio (int16), 'W' or 'S', state,
+// two bytes of padding
+static void put_record(char* out, const TraceEvent& e) {
+    int64_t time = e.time;
+    int32_t pid = e.pid, next = e.next;
+    int16_t prio = e.prio, nextPrio = e.nextPrio;
+    std::memcpy(out, &time, 8);
+    std::memcpy(out + 8, &pid, 4);
+    std::memcpy(out + 12, &next, 4);
+    std::memcpy(out + 16, &prio, 2);
+    std::memcpy(out + 18, &nextPrio, 2);
+    out[20] = e.wakeup ? 'W' : 'S';
+    out[21] = e.state;
+    out[22] = out[23] = 0;
+}
+
+static TraceEvent get_record(const char* in) {
+    int64_t time;
+    int32_t pid, next;
+    int16_t prio, nextPrio;
+    std::memcpy(&time, in, 8);
+    std::memcpy(&pid, in + 8, 4);
+    std::memcpy(&next, in + 12, 4);
+    std::memcpy(&prio, in + 16, 2);
+    std::memcpy(&nextPrio, in + 18, 2);
+    return { time, in[20] == 'W', pid, next, prio, nextPrio, in[21] };
+}
+
+// Calls f(event) for every switch and wakeup in the file, text or binary
+template <typename F>
+static void for_each_event(const std::string& path, F&& f) {
+    char magic[sizeof MAGIC] = {};
+    std::ifstream(path, std::ios::binary).read(magic, sizeof magic);
+    bool binary = std::memcmp(magic, MAGIC, sizeof MAGIC) == 0;
+    bool header = binary;
+
+    for_each_window(path, [&](const char* data, size_t len, bool last) {
+        size_t pos = 0;
+        if (binary) {
+            if (header) pos = sizeof MAGIC;
+            header = false;
+            for (; pos + RECORD <= len; pos += RECORD) f(get_record(data + pos));
+            if (last && pos != len) throw std::runtime_error(path + ": truncated record");
+            return pos;
+        }
+        TraceEvent e;
+        while (pos < len) {
+            const char* nl = static_cast<const char*>(std::memchr(data + pos, '\n', len - pos));
+            if (!nl && !last) break;
+            size_t end = nl ? nl - data : len;
+            e = TraceEvent();
+            if (parse_line(std::string_view(data + pos, end - pos), e)) f(e);
+            pos = end + 1;
+        }
+        return std::min(pos, len);
+    });
+}
+
+// Per-task state machine over the event stream
+class TraceBuilder {
+public:
+    explicit TraceBuilder(const TraceOptions& options) : tick(std::max(1LL, options.tickNs)), keepBursts(options.bursts) {}
+
+    void add(const TraceEvent& e) {
+        if (first < 0) first = e.time;
+        last = std::max(last, e.time);
+        events++;
+        if (e.wakeup) {
+            if (e.pid != 0) wake(find(e.pid, e.prio, e.time, Runnable), e.time);
+            return;
+        }
+        if (e.pid != 0) switchOut(e.pid, e.prio, e.state, e.time);
+        if (e.next != 0) {
+            Task& k = find(e.next, e.nextPrio, e.time, Runnable);
+            wake(k, e.time);   // a wakeup that was not traced
+            k.state = Running;
+            k.since = e.time;
+        }
+    }
+
+    TraceWorkload finish();
+
+private:
+    enum State { Running, Runnable, Blocked };
+
+    struct Task {
+        int tid, nice;
+        long long arrival;            // ns
+        State state;
+        long long since;              // on the CPU or blocked since, ns
+        long long cpuNs = 0;          // current CPU burst so far
+        long long carryNs = 0;        // CPU time short of a whole tick
+        long long cpuTicks = 0;
+        int lastBurst = -1;
+    };
+
+    struct Burst {
+        int task, length, device;
+    };
+
+    // The live task with this pid, created in `state` if there is none
+    Task& find(int tid, int prio, long long t, State state) {
+        auto [it, added] = live.try_emplace(tid, static_cast<int>(tasks.size()));
+        if (added) tasks.push_back({ tid, prio - 120, t, state, t });
+        return tasks[it->second];
+    }
+
+    void wake(Task& k, long long t) {
+        if (k.state != Blocked) return;
+        append(k, ticks(t - k.since + tick / 2), BurstInput::SLEEP);
+        k.state = Runnable;
+    }
+
+    void switchOut(int tid, int prio, char state, long long t) {
+        // Already on the CPU when the trace started
+        Task& k = find(tid, prio, first, Running);
+        if (k.state == Running) k.cpuNs += t - k.since;
+        if (state == 'R') {
+            k.state = Runnable;
+            return;
+        }
+        endCpu(k);
+        k.state = Blocked;
+        k.since = t;
+        if (state == 'X' || state == 'Z') live.erase(tid);   // exited; the pid may be reused
+    }
+
+    void endCpu(Task& k) {
+        long long ns = k.cpuNs + k.carryNs;
+        k.cpuNs = 0;
+        k.carryNs = ns % tick;
+        append(k, ticks(ns), BurstInput::CPU);
+    }
+
+    void append(Task& k, int length, int device) {
+        if (length == 0) return;
+        if (device == BurstInput::CPU) k.cpuTicks += length;
+        if (!keepBursts) return;
+        if (k.lastBurst >= 0 && bursts[k.lastBurst].device == device) {
+            if (bursts[k.lastBurst].length > INT_MAX - length) throw std::runtime_error(TOO_LONG);
+            bursts[k.lastBurst].length += length;
+            return;
+        }
+        k.lastBurst = static_cast<int>(bursts.size());
+        bursts.push_back({ static_cast<int>(&k - tasks.data()), length, device });
+    }
+
+    int ticks(long long ns) const {
+        if (ns / tick > INT_MAX) throw std::runtime_error(TOO_LONG);
+        return static_cast<int>(std::max(0LL, ns / tick));
+    }
+
+    static constexpr const char* TOO_LONG = "trace does not fit in int ticks; use a larger tick";
+
+    long long tick;
+    bool keepBursts;
+    std::unordered_map<int, int> live;   // pid -> task
+    std::vector<Task> tasks;
+    std::vector<Burst> bursts;           // time order
+    long long first = -1, last = 0, events = 0;
+};
+
+TraceWorkload TraceBuilder::finish() {
+    for (auto& k : tasks) {
+        if (k.state == Running) k.cpuNs += last - k.since;
+        if (k.state != Blocked) endCpu(k);
+    }
+
+    // Tasks with CPU time become processes, in order of first appearance
+    std::vector<int> index(tasks.size(), -1), count;
+    TraceWorkload w;
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        if (tasks[i].cpuTicks == 0) continue;
+        index[i] = static_cast<int>(w.tid.size());
+        w.tid.push_back(tasks[i].tid);
+        count.push_back(keepBursts ? 0 : 1);
+    }
+    if (keepBursts)
+        for (const auto& b : bursts)
+            if (index[b.task] >= 0) count[index[b.task]]++;
+
+    int n = w.tid.size();
+    long long total = 0;
+    for (int c : count) total += c;
+    w.input = BurstInput(n, static_cast<int>(total));
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        int p = index[i];
+        if (p < 0) continue;
+        w.input.arrival[p] = ticks(tasks[i].arrival - first);
+        w.input.priority[p] = tasks[i].nice;
+        w.input.first[p + 1] = w.input.first[p] + count[p];
+    }
+
+    std::vector<int> next(w.input.first.begin(), w.input.first.end() - 1);
+    auto put = [&](int p, int length, int device) {
+        w.input.length[next[p]] = length;
+        w.input.device[next[p]++] = device;
+    };
+    if (!keepBursts) {
+        for (size_t i = 0; i < tasks.size(); ++i)
+            if (index[i] >= 0) put(index[i], static_cast<int>(std::min<long long>(INT_MAX, tasks[i].cpuTicks)), BurstInput::CPU);
+    } else {
+        for (const auto& b : bursts)
+            if (index[b.task] >= 0) put(index[b.task], b.length, b.device);
+    }
+    w.events = events;
+    return w;
+}
+
+ProcessInput TraceWorkload::summary() const {
+    int n = input.size();
+    ProcessInput out(n);
+    for (int i = 0; i < n; ++i) {
+        long long cpu = 0;
+        for (int k = input.first[i]; k < input.first[i + 1]; ++k)
+            if (input.device[k] == BurstInput::CPU) cpu += input.length[k];
+        out.arrival[i] = input.arrival[i];
+        out.burst[i] = static_cast<int>(std::min<long long>(INT_MAX, cpu));
+        out.priority[i] = input.priority[i];
+    }
+    return out;
+}
+
+TraceWorkload read_trace(const std::string& path, const TraceOptions& options) {
+    TraceBuilder builder(options);
+    for_each_event(path, [&](const TraceEvent& e) { builder.add(e); });
+    return builder.finish();
+}
+
+long long convert_trace(const std::string& in, const std::string& out) {
+    std::ofstream os(out, std::ios::binary);
+    if (!os) throw std::runtime_error(out + ": cannot open");
+    os.write(MAGIC, sizeof MAGIC);
+
+    std::vector<char> buffer;
+    buffer.reserve(RECORD * 65536);
+    long long written = 0;
+    for_each_event(in, [&](const TraceEvent& e) {
+        buffer.resize(buffer.size() + RECORD);
+        put_record(buffer.data() + buffer.size() - RECORD, e);
+        written++;
+        if (buffer.size() == buffer.capacity()) {
+            os.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    });
+    os.write(buffer.data(), buffer.size());
+    if (!os) throw std::runtime_error(out + ": write failed");
+    return written;
+}
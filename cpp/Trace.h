@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Io.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+// Trace replay (native build only): turns sched_switch / sched_wakeup
+// events captured on a real host into workloads for the engines. Text from
+// `perf sched script` (key=value or the compact "comm:pid [prio] S ==> ..."
+// form) and from ftrace's trace / trace_pipe is accepted, as is the binary
+// format convert_trace() writes. Files are memory-mapped a window at a time
+// and parsed in one pass, so the whole file is never resident; memory grows
+// with the number of tasks (and of bursts, when they are kept).
+//
+// Each task (kernel pid) becomes one process. It arrives when first seen
+// runnable: woken, or on the CPU already when the trace starts. Time on the
+// CPU adds to its current CPU burst; being switched out in a sleeping state
+// ends the burst, and the time until its next wakeup becomes a SLEEP burst
+// (see BurstInput), so sleeps never queue behind each other. Being preempted
+// (state R) keeps the burst going. Priorities are nice values (prio - 120).
+// Times are counted from the first event in ticks of tickNs; sub-tick CPU
+// time carries over to the task's next burst, and tasks that never
+// accumulate a whole tick are left out.
+
+struct TraceOptions {
+    long long tickNs = 1000000;   // trace time per simulated tick
+    bool bursts = true;           // keep CPU/I-O sequences; false keeps one CPU total per task
+};
+
+struct TraceWorkload {
+    std::vector<int> tid;         // kernel pid of each process, in order of first appearance
+    BurstInput input{ 0, 0 };
+    long long events = 0;         // switch and wakeup events read
+
+    // Arrival, total CPU and nice per process, for the single-burst engines
+    ProcessInput summary() const;
+};
+
+// Throws std::runtime_error when the file cannot be read or its times do
+// not fit in int ticks
+TraceWorkload read_trace(const std::string& path, const TraceOptions& options = {});
+
+// Rewrites a text trace as fixed 24-byte little-endian records behind an
+// 8-byte "SCHEDTR1" magic; read_trace() detects the format by that magic.
+// Returns the number of events written.
+long long convert_trace(const std::string& in, const std::string& out);
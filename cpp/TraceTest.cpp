@@ -0,0 +1,110 @@
+// Trace replay: one small sched_switch / sched_wakeup history written as
+// ftrace text, as perf sched script text and as the binary records, all read
+// back into the same workload
+
+#include "Tests.h"
+#include "Trace.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+// Task 100 runs 0-3 ms, sleeps until woken at 5, runs 8-10 and exits; task
+// 200 (nice 5) first shows up switched in at 3 and is preempted at 8
+static const char* FTRACE =
+    "# tracer: nop\n"
+    "          <idle>-0       [000] d..2  1.000000: sched_wakeup: comm=a pid=100 prio=120 target_cpu=000\n"
+    "          <idle>-0       [000] d..2  1.000000: sched_switch: prev_comm=swapper/0 prev_pid=0 prev_prio=120 prev_state=R ==> next_comm=a next_pid=100 next_prio=120\n"
+    "               a-100     [000] d..2  1.003000: sched_switch: prev_comm=a prev_pid=100 prev_prio=120 prev_state=S ==> next_comm=b next_pid=200 next_prio=125\n"
+    "          <idle>-0       [001] d..2  1.005000: sched_wakeup: comm=a pid=100 prio=120 target_cpu=000\n"
+    "               b-200     [000] d..2  1.008000: sched_switch: prev_comm=b prev_pid=200 prev_prio=125 prev_state=R ==> next_comm=a next_pid=100 next_prio=120\n"
+    "               a-100     [000] d..2  1.010000: sched_switch: prev_comm=a prev_pid=100 prev_prio=120 prev_state=X ==> next_comm=swapper/0 next_pid=0 next_prio=120\n";
+
+static const char* PERF =
+    "         swapper     0 [000]     1.000000: sched:sched_wakeup: a:100 [120] success=1 CPU:000\n"
+    "         swapper     0 [000]     1.000000: sched:sched_switch: swapper/0:0 [120] R ==> a:100 [120]\n"
+    "               a   100 [000]     1.003000: sched:sched_switch: a:100 [120] S ==> b:200 [125]\n"
+    "         swapper     0 [001]     1.005000: sched:sched_wakeup: a:100 [120] success=1 CPU:000\n"
+    "               b   200 [000]     1.008000: sched:sched_switch: b:200 [125] R ==> a:100 [120]\n"
+    "               a   100 [000]     1.010000: sched:sched_switch: a:100 [120] X ==> swapper/0:0 [120]\n"
+    "               a   100 [000]     1.010500: sched:sched_stat_runtime: comm=a pid=100 runtime=500\n";
+
+// A scratch file removed when the test is done
+struct TempFile {
+    std::string path;
+
+    TempFile(const std::string& name, const std::string& text = "")
+        : path((std::filesystem::temp_directory_path() / ("schedulr-" + std::to_string(getpid()) + "-" + name)).string()) {
+        if (!text.empty()) std::ofstream(path, std::ios::binary) << text;
+    }
+    ~TempFile() { std::remove(path.c_str()); }
+};
+
+static bool same(const TraceWorkload& a, const TraceWorkload& b) {
+    return a.tid == b.tid && a.events == b.events && a.input.arrival == b.input.arrival &&
+           a.input.priority == b.input.priority && a.input.first == b.input.first &&
+           a.input.length == b.input.length && a.input.device == b.input.device;
+}
+
+static TestCase bursts("trace bursts", [] {
+    TempFile ftrace("ftrace.txt", FTRACE);
+    TraceWorkload w = read_trace(ftrace.path);
+    int cpu = BurstInput::CPU, sleep = BurstInput::SLEEP;
+    check(w.tid == std::vector<int>{ 100, 200 } && w.events == 6, "trace tasks and events");
+    check(w.input.arrival == std::vector<int>{ 0, 3 } && w.input.priority == std::vector<int>{ 0, 5 },
+          "trace arrivals and nice values");
+    check(w.input.first == std::vector<int>{ 0, 3, 4 } && w.input.length == std::vector<int>{ 3, 2, 2, 5 } &&
+              w.input.device == std::vector<int>{ cpu, sleep, cpu, cpu },
+          "trace CPU and sleep bursts; a preemption keeps the burst going");
+
+    ProcessInput s = w.summary();
+    check(s.arrival == std::vector<int>{ 0, 3 } && s.burst == std::vector<int>{ 5, 5 } &&
+              s.priority == std::vector<int>{ 0, 5 },
+          "trace summary totals the CPU bursts");
+
+    TraceOptions totals;
+    totals.bursts = false;
+    TraceWorkload t = read_trace(ftrace.path, totals);
+    check(t.input.length == std::vector<int>{ 5, 5 } && t.input.device == std::vector<int>{ cpu, cpu },
+          "trace without bursts keeps one CPU total per task");
+
+    TraceOptions fine;
+    fine.tickNs = 500000;
+    check(read_trace(ftrace.path, fine).input.length == std::vector<int>{ 6, 4, 4, 10 }, "trace tick length");
+});
+
+// perf's compact lines and the binary records give the same workload as
+// ftrace's key=value lines; events other than switches and wakeups are skipped
+static TestCase formats("trace formats", [] {
+    TempFile ftrace("ftrace.txt", FTRACE), perf("perf.txt", PERF), binary("trace.bin");
+    TraceWorkload expect = read_trace(ftrace.path);
+    check(same(read_trace(perf.path), expect), "perf sched script matches ftrace");
+
+    check(convert_trace(perf.path, binary.path) == 6, "convert_trace event count");
+    check(same(read_trace(binary.path), expect), "binary records match the text");
+});
+
+static TestCase errors("trace errors", [] {
+    bool threw = false;
+    try {
+        read_trace(TempFile("missing").path);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    check(threw, "trace missing file throws");
+
+    // A binary file cut inside a record
+    TempFile ftrace("ftrace.txt", FTRACE), binary("trace.bin");
+    convert_trace(ftrace.path, binary.path);
+    std::filesystem::resize_file(binary.path, std::filesystem::file_size(binary.path) - 5);
+    threw = false;
+    try {
+        read_trace(binary.path);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    check(threw, "trace truncated record throws");
+});
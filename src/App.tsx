@@ -2,31 +2,14 @@
 import { useEffect } from "react";
 import SchedulerPanel from "./components/SchedulerPanel";
 import Footer from "./components/Footer";
+import { startScheduler } from "./scheduler";
 
 import "./index.css";
 
 function App() {
   useEffect(() => {
-    const loadScript = (src: string, name: string) => {
-      const script = document.createElement("script");
-      script.src = src;
-      script.async = true;
-
-      script.onload = () => {
-        console.log(`${name} WASM Module loaded.`);
-      };
-
-      script.onerror = () => {
-        console.error(`Failed to load ${name} WASM module.`);
-      };
-
-      document.body.appendChild(script);
-    };
-
-    loadScript("/fcfs.js", "FCFS");
-    loadScript("/sjf.js", "SJF");
-    loadScript("/rr.js", "RR");
-    loadScript("/priority.js", "PRIORITY");
+    // Start the worker up front so the module is ready by the first run
+    startScheduler();
   }, []);
 
   return (
@@ -1,13 +1,16 @@
-import { useState } from "react";
+import { useEffect, useRef, useState } from "react";
 import Results from "./Results";
 import GanttChart from "./GanttChart";
 import ProcessStateVisualizer from "./ProcessStateVisualizer";
+import RunStatus from "./RunStatus";
+import { cancelSession, closeSession, runSession, RunCancelled, type ScheduleSession } from "../scheduler";
 import { motion } from "framer-motion";
 import { PlusCircle, Play, Cpu } from "lucide-react";
 
 function FCFSForm() {
   const [processes, setProcesses] = useState([{ arrival: 0, burst: 1 }]);
   const [result, setResult] = useState<any | null>(null);
+  const [progress, setProgress] = useState<number | null>(null);
 
   const addProcess = () => {
     setProcesses([...processes, { arrival: 0, burst: 1 }]);
@@ -19,26 +22,21 @@ function FCFSForm() {
     setProcesses(newProcs);
   };
 
+  const session = useRef<ScheduleSession>(null);
+  useEffect(() => () => closeSession(session), []);
+
   const handleSubmit = async (e: React.FormEvent) => {
     e.preventDefault();
 
-    const arrivalTimes = processes.map((p) => p.arrival);
-    const burstTimes = processes.map((p) => p.burst);
-
-    const FCFSModule = await (window as any).FCFSModule();
-    const VectorInt = FCFSModule.VectorInt;
-
-    const arrivalVec = new VectorInt();
-    const burstVec = new VectorInt();
-
-    arrivalTimes.forEach((t) => arrivalVec.push_back(t));
-    burstTimes.forEach((t) => burstVec.push_back(t));
-
-    const output = JSON.parse(FCFSModule.fcfs_schedule(arrivalVec, burstVec));
-    setResult(output);
-
-    arrivalVec.delete();
-    burstVec.delete();
+    setProgress(0);
+    try {
+      setResult(await runSession(session, "fcfs", 0, processes, setProgress));
+    } catch (err) {
+      if (!(err instanceof RunCancelled)) throw err;
+    } finally {
+      // A run replaced by a newer one leaves that run's progress showing
+      if (session.current?.run == null) setProgress(null);
+    }
   };
 
   return (
@@ -153,6 +151,7 @@ function FCFSForm() {
               <Play className="w-6 h-6" />
               Schedule
             </button>
+            <RunStatus progress={progress} onCancel={() => cancelSession(session)} />
           </form>
         </div>
 
@@ -166,12 +165,11 @@ function FCFSForm() {
             />
             <GanttChart
               processes={result.process_table}
-              runningProcessMap={result.running_process}
+              session={session}
             />
             <ProcessStateVisualizer
               processes={result.process_table}
-              readyQueue={result.ready_queue}
-              runningProcessMap={result.running_process}
+              session={session}
               completedPIDs={result.completed}
             />
           </div>
@@ -1,11 +1,7 @@
-import { useEffect, useState, useMemo } from "react";
+import { useEffect, useState } from "react";
 import { motion } from "framer-motion";
 import { BarChart2 } from "lucide-react";
-
-type TimelineEntry = {
-  time: number;
-  pid: number; // -1 for idle
-};
+import { windowSegments, type ScheduleSession } from "../scheduler";
 
 type Process = {
   pid: number;
@@ -17,43 +13,36 @@ type Process = {
 
 type GanttChartProps = {
   processes: Process[];
-  runningProcessMap: Record<number, number>;
+  session: { current: ScheduleSession };
+};
+
+type Block = {
+  start: number;
+  end: number;
+  pid: number; // -1 for idle
 };
 
 const colorPalette = [
   "#6366f1", "#10b981", "#f59e0b", "#ef4444", "#3b82f6", "#8b5cf6", "#ec4899"
 ];
 
-const GanttChart = ({ processes, runningProcessMap }: GanttChartProps) => {
-  const [currentTime, setCurrentTime] = useState(0);
-
-  const timeline: TimelineEntry[] = useMemo(() => {
-    const times = Object.keys(runningProcessMap).map(Number);
-    if (times.length === 0) return [];
+// Ticks on screen at once; longer runs page along with the playhead, and
+// only the page shown is fetched from the worker
+const WINDOW = 40;
 
-    const minTime = Math.min(...times);
-    const maxTime = Math.max(...times);
-
-    const result: TimelineEntry[] = [];
-    let lastPid: number | null = null;
-
-    for (let t = minTime; t <= maxTime + 1; t++) {
-      const pid = runningProcessMap.hasOwnProperty(t) ? runningProcessMap[t] : -1;
-      if (pid !== lastPid) {
-        result.push({ time: t, pid });
-        lastPid = pid;
-      }
-    }
-
-    return result;
-  }, [runningProcessMap]);
+const GanttChart = ({ processes, session }: GanttChartProps) => {
+  const startTime = processes.reduce((t, p) => Math.min(t, p.start), Infinity);
+  const endTime = processes.reduce((t, p) => Math.max(t, p.end), 0);
+  const totalTime = endTime - startTime;
 
-  if (!timeline.length || !processes.length) return null;
+  const [currentTime, setCurrentTime] = useState(0);
+  const [segments, setSegments] = useState<Int32Array>(new Int32Array(0));
 
-  const sortedTimeline = [...timeline].sort((a, b) => a.time - b.time);
-  const startTime = sortedTimeline[0].time;
-  const endTime = Math.max(...processes.map((p) => p.end));
-  const totalTime = endTime - startTime;
+  // The page holding the playhead, the last one ending at endTime
+  const width = Math.min(WINDOW, totalTime);
+  const page = width > 0 ? Math.floor((currentTime - startTime) / width) : 0;
+  const windowStart = Math.max(startTime, Math.min(startTime + page * width, endTime - width));
+  const windowEnd = windowStart + width;
 
   useEffect(() => {
     setCurrentTime(startTime);
@@ -67,41 +56,62 @@ const GanttChart = ({ processes, runningProcessMap }: GanttChartProps) => {
       });
     }, 1000);
     return () => clearInterval(interval);
-  }, [timeline]);
-
-  const buildBlocks = () => {
-    const blocks = [];
-
-    for (let i = 0; i < sortedTimeline.length; i++) {
-      const current = sortedTimeline[i];
-      const next = sortedTimeline[i + 1];
-      const start = current.time;
-      const end = next ? next.time : endTime;
-      const duration = end - start;
+  }, [processes]);
 
-      if (duration <= 0) continue;
-
-      const widthPercent = (duration / totalTime) * 100;
+  useEffect(() => {
+    if (!(width > 0)) return;
+    let stale = false;
+    windowSegments(session, windowStart, windowEnd).then((s) => {
+      if (!stale) setSegments(s);
+    });
+    return () => {
+      stale = true;
+    };
+  }, [processes, windowStart, windowEnd]);
+
+  if (!processes.length || !(width > 0)) return null;
+
+  // Segments clipped to the window, gaps filled with idle blocks and
+  // back-to-back slices of one process joined
+  const blocks: Block[] = [];
+  const add = (start: number, end: number, pid: number) => {
+    if (end <= start) return;
+    const last = blocks[blocks.length - 1];
+    if (last && last.pid === pid && last.end === start) last.end = end;
+    else blocks.push({ start, end, pid });
+  };
+  let at = windowStart;
+  for (let i = 0; i + 2 < segments.length; i += 3) {
+    const start = Math.max(segments[i], windowStart);
+    const end = Math.min(segments[i + 1], windowEnd);
+    if (end <= start) continue;
+    add(at, start, -1);
+    add(start, end, segments[i + 2]);
+    at = end;
+  }
+  add(at, windowEnd, -1);
+
+  const buildBlocks = () =>
+    blocks.map(({ start, end, pid }) => {
+      const widthPercent = ((end - start) / width) * 100;
       const isActive = currentTime >= start && currentTime < end;
 
       const style = {
         width: `${widthPercent}%`,
         backgroundColor:
-          current.pid === -1
-            ? "#d1d5db"
-            : colorPalette[current.pid % colorPalette.length],
+          pid === -1 ? "#d1d5db" : colorPalette[pid % colorPalette.length],
       };
 
-      const label = current.pid === -1 ? "Idle" : `P${current.pid}`;
+      const label = pid === -1 ? "Idle" : `P${pid}`;
 
-      blocks.push(
+      return (
         <motion.div
           key={`block-${start}`}
           initial={{ opacity: 0, scale: 0.95 }}
           animate={{ opacity: 1, scale: 1 }}
           transition={{ duration: 0.3 }}
           className={`h-full flex items-center justify-center text-xs font-semibold ${
-            current.pid === -1 ? "text-gray-700" : "text-white"
+            pid === -1 ? "text-gray-700" : "text-white"
           } ${isActive ? "ring-2 ring-offset-1 ring-indigo-500" : ""}`}
           style={style}
           title={`${label} (${start} - ${end})`}
@@ -109,17 +119,14 @@ const GanttChart = ({ processes, runningProcessMap }: GanttChartProps) => {
           {label}
         </motion.div>
       );
-    }
-
-    return blocks;
-  };
+    });
 
   const renderTimeLabels = () => {
     const labels = [];
-    const step = totalTime > 20 ? 2 : 1;
+    const step = width > 20 ? 2 : 1;
 
-    for (let t = startTime; t <= endTime; t += step) {
-      const leftPercent = ((t - startTime) / totalTime) * 100;
+    for (let t = windowStart; t <= windowEnd; t += step) {
+      const leftPercent = ((t - windowStart) / width) * 100;
       labels.push(
         <div
           key={t}
@@ -1,13 +1,16 @@
-import { useState } from "react";
+import { useEffect, useRef, useState } from "react";
 import Results from "./Results";
 import GanttChart from "./GanttChart";
 import ProcessStateVisualizer from "./ProcessStateVisualizer";
+import RunStatus from "./RunStatus";
+import { cancelSession, closeSession, runSession, RunCancelled, type ScheduleSession } from "../scheduler";
 import { motion } from "framer-motion";
 import { Cpu, PlusCircle, Play } from "lucide-react";
 
 function PRIORITYForm() {
   const [processes, setProcesses] = useState([{ arrival: 0, burst: 1, priority: 1 }]);
   const [result, setResult] = useState<any | null>(null);
+  const [progress, setProgress] = useState<number | null>(null);
   const [mode, setMode] = useState<"non-preemptive" | "preemptive">("non-preemptive");
 
   const addProcess = () => {
@@ -24,34 +27,22 @@ function PRIORITYForm() {
     setProcesses(newProcs);
   };
 
+  const session = useRef<ScheduleSession>(null);
+  useEffect(() => () => closeSession(session), []);
+
   const handleSubmit = async (e: React.FormEvent) => {
     e.preventDefault();
 
-    const arrivalTimes = processes.map((p) => p.arrival);
-    const burstTimes = processes.map((p) => p.burst);
-    const priorities = processes.map((p) => p.priority);
-
-    const PModule = await (window as any).PModule();
-    const VectorInt = PModule.VectorInt;
-
-    const arrivalVec = new VectorInt();
-    const burstVec = new VectorInt();
-    const priorityVec = new VectorInt();
-
-    arrivalTimes.forEach((t) => arrivalVec.push_back(t));
-    burstTimes.forEach((t) => burstVec.push_back(t));
-    priorities.forEach((p) => priorityVec.push_back(p));
-
-    const output = JSON.parse(
-      mode === "non-preemptive"
-        ? PModule.priority_schedule(arrivalVec, burstVec, priorityVec)
-        : PModule.priority_preemptive_schedule(arrivalVec, burstVec, priorityVec)
-    );
-    setResult(output);
-
-    arrivalVec.delete();
-    burstVec.delete();
-    priorityVec.delete();
+    const policy = mode === "non-preemptive" ? "priority" : "priority-preemptive";
+    setProgress(0);
+    try {
+      setResult(await runSession(session, policy, 0, processes, setProgress));
+    } catch (err) {
+      if (!(err instanceof RunCancelled)) throw err;
+    } finally {
+      // A run replaced by a newer one leaves that run's progress showing
+      if (session.current?.run == null) setProgress(null);
+    }
   };
 
   return (
@@ -201,6 +192,7 @@ function PRIORITYForm() {
               <Play className="w-5 h-5" />
               Schedule
             </button>
+            <RunStatus progress={progress} onCancel={() => cancelSession(session)} />
           </form>
         </div>
 
@@ -214,12 +206,11 @@ function PRIORITYForm() {
             />
             <GanttChart
               processes={result.process_table}
-              runningProcessMap={result.running_process}
+              session={session}
             />
             <ProcessStateVisualizer
               processes={result.process_table}
-              readyQueue={result.ready_queue}
-              runningProcessMap={result.running_process}
+              session={session}
               completedPIDs={result.completed}
             />
           </div>
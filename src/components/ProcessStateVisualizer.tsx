@@ -7,6 +7,7 @@ import {
   CheckCircle,
   Cpu,
 } from "lucide-react";
+import { stateAt, type ScheduleSession } from "../scheduler";
 
 type Process = {
   pid: number;
@@ -17,24 +18,24 @@ type Process = {
 
 type Props = {
   processes: Process[];
-  readyQueue: Record<number, number[]>;
-  runningProcessMap: Record<number, number>;
+  session: { current: ScheduleSession };
   completedPIDs: number[];
 };
 
+// CPU and ready queue at one tick, asked of the worker as the clock moves
+type TickState = { running: number; ready: Int32Array };
+const NOTHING: TickState = { running: -1, ready: new Int32Array(0) };
+
 const ProcessStateVisualizer = ({
   processes,
-  readyQueue,
-  runningProcessMap,
+  session,
   completedPIDs,
 }: Props) => {
   const [currentTime, setCurrentTime] = useState(0);
+  const [state, setState] = useState<TickState>(NOTHING);
   const intervalRef = useRef<number | null>(null);
 
-  const maxTime = Math.max(
-    ...Object.keys(runningProcessMap).map((t) => parseInt(t, 10)),
-    ...processes.map((p) => p.end ?? 0)
-  );
+  const maxTime = processes.reduce((t, p) => Math.max(t, p.end ?? 0), 0);
 
   const startSimulation = () => {
     if (intervalRef.current) clearInterval(intervalRef.current);
@@ -58,13 +59,22 @@ const ProcessStateVisualizer = ({
     };
   }, [maxTime]);
 
-  const currentReadyQueue: Process[] = (readyQueue[currentTime] || [])
+  useEffect(() => {
+    let stale = false;
+    stateAt(session, currentTime).then((s) => {
+      if (!stale) setState(s);
+    });
+    return () => {
+      stale = true;
+    };
+  }, [processes, currentTime]);
+
+  const currentReadyQueue: Process[] = Array.from(state.ready)
     .map((pid) => processes.find((p) => p.pid === pid))
     .filter((p): p is Process => !!p);
 
-  const currentRunningPID = runningProcessMap[currentTime];
   const runningProcess =
-    processes.find((p) => p.pid === currentRunningPID) || null;
+    processes.find((p) => p.pid === state.running) || null;
 
   const completed: Process[] = completedPIDs
     .map((pid) => processes.find((p) => p.pid === pid))
@@ -1,7 +1,9 @@
-import { useState } from "react";
+import { useEffect, useRef, useState } from "react";
 import Results from "./Results";
 import GanttChart from "./GanttChart";
 import ProcessStateVisualizer from "./ProcessStateVisualizer";
+import RunStatus from "./RunStatus";
+import { cancelSession, closeSession, runSession, RunCancelled, type ScheduleSession } from "../scheduler";
 import { motion } from "framer-motion";
 import { Cpu, PlusCircle, Play } from "lucide-react";
 
@@ -9,6 +11,7 @@ function RRForm() {
   const [processes, setProcesses] = useState([{ arrival: 0, burst: 1 }]);
   const [quantum, setQuantum] = useState(2);
   const [result, setResult] = useState<any | null>(null);
+  const [progress, setProgress] = useState<number | null>(null);
 
   const addProcess = () => {
     setProcesses([...processes, { arrival: 0, burst: 1 }]);
@@ -20,26 +23,21 @@ function RRForm() {
     setProcesses(newProcs);
   };
 
+  const session = useRef<ScheduleSession>(null);
+  useEffect(() => () => closeSession(session), []);
+
   const handleSubmit = async (e: React.FormEvent) => {
     e.preventDefault();
 
-    const arrivalTimes = processes.map((p) => p.arrival);
-    const burstTimes = processes.map((p) => p.burst);
-
-    const RRModule = await (window as any).RRModule();
-    const VectorInt = RRModule.VectorInt;
-
-    const arrivalVec = new VectorInt();
-    const burstVec = new VectorInt();
-
-    arrivalTimes.forEach((t) => arrivalVec.push_back(t));
-    burstTimes.forEach((t) => burstVec.push_back(t));
-
-    const output = JSON.parse(RRModule.rr_schedule(arrivalVec, burstVec, quantum));
-    setResult(output);
-
-    arrivalVec.delete();
-    burstVec.delete();
+    setProgress(0);
+    try {
+      setResult(await runSession(session, "rr", quantum, processes, setProgress));
+    } catch (err) {
+      if (!(err instanceof RunCancelled)) throw err;
+    } finally {
+      // A run replaced by a newer one leaves that run's progress showing
+      if (session.current?.run == null) setProgress(null);
+    }
   };
 
   return (
@@ -178,6 +176,7 @@ function RRForm() {
             Schedule
             </button>
 
+            <RunStatus progress={progress} onCancel={() => cancelSession(session)} />
           </form>
         </div>
 
@@ -191,12 +190,11 @@ function RRForm() {
             />
             <GanttChart
               processes={result.process_table}
-              runningProcessMap={result.running_process}
+              session={session}
             />
             <ProcessStateVisualizer
               processes={result.process_table}
-              readyQueue={result.ready_queue}
-              runningProcessMap={result.running_process}
+              session={session}
               completedPIDs={result.completed}
             />
           </div>
@@ -0,0 +1,33 @@
+import { XCircle } from "lucide-react";
+
+type RunStatusProps = {
+  progress: number | null;   // share of processes finished, null when idle
+  onCancel: () => void;
+};
+
+// Progress of a run in the scheduler worker, with a way to stop it
+const RunStatus = ({ progress, onCancel }: RunStatusProps) => {
+  if (progress === null) return null;
+
+  return (
+    <div className="flex items-center gap-3">
+      <div className="flex-1 h-2 bg-gray-200 rounded-full overflow-hidden">
+        <div
+          className="h-full bg-gray-500 transition-all"
+          style={{ width: `${Math.round(progress * 100)}%` }}
+        />
+      </div>
+      <span className="text-sm text-gray-600 w-12 text-right">{Math.round(progress * 100)}%</span>
+      <button
+        type="button"
+        onClick={onCancel}
+        className="flex items-center gap-1 text-sm text-red-600 hover:text-red-800"
+      >
+        <XCircle className="w-4 h-4" />
+        Cancel
+      </button>
+    </div>
+  );
+};
+
+export default RunStatus;
@@ -1,13 +1,16 @@
-import { useState } from "react";
+import { useEffect, useRef, useState } from "react";
 import Results from "./Results";
 import GanttChart from "./GanttChart";
 import ProcessStateVisualizer from "./ProcessStateVisualizer";
+import RunStatus from "./RunStatus";
+import { cancelSession, closeSession, runSession, RunCancelled, type ScheduleSession } from "../scheduler";
 import { motion } from "framer-motion";
 import { Cpu, Play, PlusCircle } from "lucide-react";
 
 function SJFForm() {
   const [processes, setProcesses] = useState([{ arrival: 0, burst: 1 }]);
   const [result, setResult] = useState<any | null>(null);
+  const [progress, setProgress] = useState<number | null>(null);
   const [mode, setMode] = useState<"non-preemptive" | "preemptive">("non-preemptive");
 
   const addProcess = () => {
@@ -20,30 +23,22 @@ function SJFForm() {
     setProcesses(newProcs);
   };
 
+  const session = useRef<ScheduleSession>(null);
+  useEffect(() => () => closeSession(session), []);
+
   const handleSubmit = async (e: React.FormEvent) => {
     e.preventDefault();
 
-    const arrivalTimes = processes.map((p) => p.arrival);
-    const burstTimes = processes.map((p) => p.burst);
-
-    const SJFModule = await (window as any).SJFModule();
-    const VectorInt = SJFModule.VectorInt;
-
-    const arrivalVec = new VectorInt();
-    const burstVec = new VectorInt();
-    arrivalTimes.forEach((t) => arrivalVec.push_back(t));
-    burstTimes.forEach((t) => burstVec.push_back(t));
-
-    const output = JSON.parse(
-      mode === "non-preemptive"
-        ? SJFModule.sjf_schedule(arrivalVec, burstVec)
-        : SJFModule.sjf_preemptive_schedule(arrivalVec, burstVec)
-    );
-
-    setResult(output);
-
-    arrivalVec.delete();
-    burstVec.delete();
+    const policy = mode === "non-preemptive" ? "sjf" : "sjf-preemptive";
+    setProgress(0);
+    try {
+      setResult(await runSession(session, policy, 0, processes, setProgress));
+    } catch (err) {
+      if (!(err instanceof RunCancelled)) throw err;
+    } finally {
+      // A run replaced by a newer one leaves that run's progress showing
+      if (session.current?.run == null) setProgress(null);
+    }
   };
 
   return (
@@ -161,6 +156,7 @@ function SJFForm() {
               <Play className="w-5 h-5" />
               Schedule
             </button>
+            <RunStatus progress={progress} onCancel={() => cancelSession(session)} />
           </form>
         </div>
 
@@ -174,12 +170,11 @@ function SJFForm() {
             />
             <GanttChart
               processes={result.process_table}
-              runningProcessMap={result.running_process}
+              session={session}
             />
             <ProcessStateVisualizer
               processes={result.process_table}
-              readyQueue={result.ready_queue}
-              runningProcessMap={result.running_process}
+              session={session}
               completedPIDs={result.completed}
             />
           </div>
@@ -0,0 +1,214 @@
+// src/scheduler.ts
+// The WebAssembly scheduler runs in one dedicated worker (scheduler.worker.ts)
+// shared by every form, so long simulations never block the UI thread.
+let worker: Worker | null = null;
+
+export type ProcessRow = { arrival: number; burst: number; priority?: number };
+
+// Tables the worker sends back; the Int32Arrays arrive as transferred
+// buffers. See BinaryResult in cpp/Simulation.h. What ran and waited at each
+// tick stays in the worker, behind windowSegments() and stateAt().
+export type RunResult = {
+  processTable: Int32Array;
+  completed: Int32Array;
+  averageTurnaround: number;
+  averageWaiting: number;
+};
+
+export type WorkerRequest =
+  | {
+      type: "run";
+      session: number;
+      run: number;
+      policy: string;
+      quantum: number;
+      arrival: Int32Array;
+      burst: Int32Array;
+      priority: Int32Array;
+    }
+  | { type: "cancel"; session: number }
+  | { type: "close"; session: number }
+  | { type: "segments"; session: number; query: number; t0: number; t1: number }
+  | { type: "state"; session: number; query: number; t: number }
+  | { type: "overview"; session: number; query: number; t0: number; t1: number; pixels: number };
+
+export type WorkerReply =
+  | { type: "progress"; run: number; progress: number }
+  | { type: "result"; run: number; result: RunResult }
+  | { type: "cancelled"; run: number }
+  | { type: "error"; run: number; message: string }
+  | { type: "segments"; query: number; segments: Int32Array }
+  | { type: "state"; query: number; running: number; ready: Int32Array }
+  | { type: "overview"; query: number; buckets: Int32Array };
+
+// Rejection of a run that was cancelled or replaced by a newer one
+export class RunCancelled extends Error {
+  constructor() {
+    super("Scheduling cancelled.");
+    this.name = "RunCancelled";
+  }
+}
+
+type Pending = {
+  policy: string;
+  resolve: (result: any) => void;
+  reject: (err: Error) => void;
+  onProgress?: (progress: number) => void;
+};
+const pending = new Map<number, Pending>();
+const queries = new Map<number, (reply: any) => void>();
+let nextRun = 1;
+let nextQuery = 1;
+let nextSession = 1;
+
+// Starts the worker, which instantiates the module right away so the
+// first run does not wait for it
+export function startScheduler(): Worker {
+  if (!worker) {
+    worker = new Worker(new URL("./scheduler.worker.ts", import.meta.url), { type: "classic" });
+    worker.onmessage = (e: MessageEvent<WorkerReply>) => {
+      const reply = e.data;
+      if (reply.type === "segments" || reply.type === "state" || reply.type === "overview") {
+        queries.get(reply.query)?.(reply);
+        queries.delete(reply.query);
+        return;
+      }
+      const p = pending.get(reply.run);
+      if (!p) return;
+      if (reply.type === "progress") {
+        p.onProgress?.(reply.progress);
+        return;
+      }
+      pending.delete(reply.run);
+      if (reply.type === "result") p.resolve(toSchedule(reply.result, p.policy));
+      else if (reply.type === "cancelled") p.reject(new RunCancelled());
+      else p.reject(new Error(reply.message));
+    };
+    worker.onerror = () => {
+      console.error("Failed to load scheduler WASM module; generate it with `npm run build:wasm`.");
+      for (const p of pending.values()) p.reject(new Error("Failed to load scheduler WASM module."));
+      pending.clear();
+    };
+  }
+  return worker;
+}
+
+// One IncrementalSchedule per form, kept in the worker: resubmitting after
+// editing a few rows only re-simulates from the earliest changed arrival
+// onwards.
+export type ScheduleSession = { id: number; run: number | null } | null;
+
+// Schedules `rows` in the session's worker-side table and resolves with the
+// legacy JSON shape, minus the per-tick running_process and ready_queue
+// maps (query the session for those). A newer run on the same session, or
+// cancelSession(), rejects this one with RunCancelled.
+export function runSession(
+  session: { current: ScheduleSession },
+  policy: string,
+  quantum: number,
+  rows: ProcessRow[],
+  onProgress?: (progress: number) => void
+): Promise<any> {
+  const w = startScheduler();
+  if (!session.current) session.current = { id: nextSession++, run: null };
+  const s = session.current;
+  const run = nextRun++;
+  s.run = run;
+
+  const arrival = Int32Array.from(rows, (r) => r.arrival);
+  const burst = Int32Array.from(rows, (r) => r.burst);
+  const priority = Int32Array.from(rows, (r) => r.priority ?? 0);
+  const request: WorkerRequest = { type: "run", session: s.id, run, policy, quantum, arrival, burst, priority };
+
+  return new Promise((resolve, reject) => {
+    pending.set(run, {
+      policy,
+      resolve: (result) => {
+        if (s.run === run) s.run = null;
+        resolve(result);
+      },
+      reject: (err) => {
+        if (s.run === run) s.run = null;
+        reject(err);
+      },
+      onProgress,
+    });
+    w.postMessage(request, [arrival.buffer, burst.buffer, priority.buffer]);
+  });
+}
+
+export function cancelSession(session: { current: ScheduleSession }) {
+  const s = session.current;
+  if (s?.run != null) worker?.postMessage({ type: "cancel", session: s.id } satisfies WorkerRequest);
+}
+
+export function closeSession(session: { current: ScheduleSession }) {
+  const s = session.current;
+  if (s) worker?.postMessage({ type: "close", session: s.id } satisfies WorkerRequest);
+  session.current = null;
+}
+
+// Window queries against the session's last finished run, answered from
+// a TimelineIndex kept in the worker so views can page through a long run
+// without the per-tick maps. Both resolve to empty results before the
+// first run finishes.
+function query(session: { current: ScheduleSession }, request: any): Promise<any> {
+  const s = session.current;
+  const w = startScheduler();
+  const id = nextQuery++;
+  return new Promise((resolve) => {
+    queries.set(id, resolve);
+    w.postMessage({ ...request, session: s ? s.id : 0, query: id });
+  });
+}
+
+// Segments overlapping [t0, t1) as start, end, pid triples in time order
+export async function windowSegments(session: { current: ScheduleSession }, t0: number, t1: number): Promise<Int32Array> {
+  return (await query(session, { type: "segments", t0, t1 })).segments;
+}
+
+// Pid on the CPU at tick t (-1 when idle) and the ready queue in order
+export async function stateAt(session: { current: ScheduleSession }, t: number): Promise<{ running: number; ready: Int32Array }> {
+  const reply = await query(session, { type: "state", t });
+  return { running: reply.running, ready: reply.ready };
+}
+
+// [t0, t1) in at most `pixels` buckets of start, end, dominant pid,
+// switches, busy ticks, read off the index's level-of-detail pyramid
+export async function windowOverview(
+  session: { current: ScheduleSession },
+  t0: number,
+  t1: number,
+  pixels: number
+): Promise<Int32Array> {
+  return (await query(session, { type: "overview", t0, t1, pixels })).buckets;
+}
+
+const PROCESS_FIELDS = 8;
+
+// Rebuilds the object the engines' JSON describes from the flat tables
+function toSchedule(r: RunResult, policy: string): any {
+  const withPriority = policy === "priority" || policy === "priority-preemptive";
+  const t = r.processTable;
+  const process_table = [];
+  for (let i = 0; i < t.length; i += PROCESS_FIELDS) {
+    process_table.push({
+      pid: t[i],
+      arrival: t[i + 1],
+      burst: t[i + 2],
+      ...(withPriority ? { priority: t[i + 3] } : {}),
+      start: t[i + 4],
+      end: t[i + 5],
+      turnaround: t[i + 6],
+      waiting: t[i + 7],
+    });
+  }
+
+  return {
+    process_table,
+    completed: Array.from(r.completed),
+    // The JSON printed these with two decimals
+    average_turnaround: Number(r.averageTurnaround.toFixed(2)),
+    average_waiting: Number(r.averageWaiting.toFixed(2)),
+  };
+}
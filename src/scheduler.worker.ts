@@ -0,0 +1,113 @@
+// src/scheduler.worker.ts
+// Runs the WebAssembly engines off the UI thread. Each form's session keeps
+// its IncrementalSchedule here and is stepped a chunk of loop iterations at
+// a time, so progress is reported and cancel messages get in between
+// chunks. Results go back as Int32Arrays whose buffers are transferred.
+import type { RunResult, WorkerReply, WorkerRequest } from "./scheduler";
+
+declare function importScripts(...urls: string[]): void;
+const ctx = self as any;
+
+// Loop iterations per chunk, a few milliseconds of simulation
+const CHUNK = 20000;
+
+importScripts("/scheduler.js");
+const scheduler: Promise<any> = ctx.SchedulerModule();
+
+type Session = { handle: any; policy: string; quantum: number; run: number; index: any };
+const sessions = new Map<number, Session>();
+
+function post(reply: WorkerReply, transfer: Transferable[] = []) {
+  ctx.postMessage(reply, transfer);
+}
+
+// Lets queued messages (a cancel, a newer run) in before the next chunk
+function yieldToMessages(): Promise<void> {
+  return new Promise((resolve) => setTimeout(resolve, 0));
+}
+
+ctx.onmessage = async (e: MessageEvent<WorkerRequest>) => {
+  const msg = e.data;
+  const s = sessions.get(msg.session);
+  if (msg.type === "cancel") {
+    s?.handle.cancel();
+  } else if (msg.type === "close") {
+    s?.index?.delete();
+    s?.handle.delete();
+    sessions.delete(msg.session);
+  } else if (msg.type === "segments") {
+    // Copied out of the index's buffer, which the next query reuses
+    const segments = s?.index ? s.index.segments(msg.t0, msg.t1).slice() : new Int32Array(0);
+    post({ type: "segments", query: msg.query, segments }, [segments.buffer]);
+  } else if (msg.type === "state") {
+    const running = s?.index ? s.index.runningAt(msg.t) : -1;
+    const ready = s?.index ? s.index.readyAt(msg.t).slice() : new Int32Array(0);
+    post({ type: "state", query: msg.query, running, ready }, [ready.buffer]);
+  } else if (msg.type === "overview") {
+    const buckets = s?.index ? s.index.overview(msg.t0, msg.t1, msg.pixels).slice() : new Int32Array(0);
+    post({ type: "overview", query: msg.query, buckets }, [buckets.buffer]);
+  } else {
+    try {
+      await run(msg);
+    } catch (err) {
+      post({ type: "error", run: msg.run, message: String(err) });
+    }
+  }
+};
+
+async function run(msg: Extract<WorkerRequest, { type: "run" }>) {
+  const Scheduler = await scheduler;
+  let s = sessions.get(msg.session);
+  // Rows can only be added or edited; anything else starts a new session
+  if (!s || s.policy !== msg.policy || s.quantum !== msg.quantum || s.handle.size() > msg.arrival.length) {
+    s?.index?.delete();
+    s?.handle.delete();
+    s = {
+      handle: new Scheduler.IncrementalSchedule(msg.policy, msg.quantum),
+      policy: msg.policy,
+      quantum: msg.quantum,
+      run: 0,
+      index: null,
+    };
+    sessions.set(msg.session, s);
+  }
+  s.run = msg.run;
+
+  // Views are taken right before writing because they go stale if WASM
+  // memory grows
+  const input = new Scheduler.ProcessInput(msg.arrival.length);
+  input.arrival().set(msg.arrival);
+  input.burst().set(msg.burst);
+  input.priority().set(msg.priority);
+  s.handle.setProcesses(input);
+  input.delete();
+
+  while (!s.handle.step(CHUNK)) {
+    if (s.handle.cancelled()) {
+      post({ type: "cancelled", run: msg.run });
+      return;
+    }
+    post({ type: "progress", run: msg.run, progress: s.handle.progress() });
+    await yieldToMessages();
+    // Closed, or a newer run took over the session
+    if (sessions.get(msg.session) !== s || s.run !== msg.run) {
+      post({ type: "cancelled", run: msg.run });
+      return;
+    }
+  }
+
+  // slice() copies each table out of WASM memory into a buffer of its own.
+  // Nothing per tick is sent: the views query the index for the ticks they
+  // show.
+  const binary = s.handle.binary();
+  const result: RunResult = {
+    processTable: binary.processTable().slice(),
+    completed: binary.completed().slice(),
+    averageTurnaround: binary.averageTurnaround,
+    averageWaiting: binary.averageWaiting,
+  };
+  binary.delete();
+  s.index?.delete();
+  s.index = s.handle.index();
+  post({ type: "result", run: msg.run, result }, [result.processTable.buffer, result.completed.buffer]);
+}